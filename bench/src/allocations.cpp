@@ -0,0 +1,44 @@
+#include "allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<size_t> allocations{0};
+
+} // namespace
+
+// The other forms of new and delete, except the aligned ones, end up in these two.
+void *operator new(size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t /*size*/) noexcept {
+    std::free(p);
+}
+
+namespace opengl_cpp::bench {
+
+size_t get_allocations() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+allocation_counter_t::allocation_counter_t(benchmark::State &state) : m_state(state), m_start(get_allocations()) {
+}
+
+allocation_counter_t::~allocation_counter_t() {
+    const auto count = static_cast<double>(get_allocations() - m_start);
+    m_state.counters["allocs"] = benchmark::Counter(count, benchmark::Counter::kAvgIterations);
+}
+
+} // namespace opengl_cpp::bench
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace opengl_cpp::bench {
+
+/**
+ * @brief Gets the amount of allocations made through the global operator new since the program started. The
+ * operator is replaced by the benchmark executable to keep this count.
+ * @return Allocations so far, over all threads.
+ */
+size_t get_allocations();
+
+/**
+ * @brief Counts the allocations made during a benchmark, reporting them as the "allocs" counter, averaged per
+ * iteration. Meant to be created right before the benchmark loop.
+ */
+class allocation_counter_t {
+  public:
+    explicit allocation_counter_t(benchmark::State &state);
+    ~allocation_counter_t();
+
+    allocation_counter_t(const allocation_counter_t &) = delete;
+    allocation_counter_t(allocation_counter_t &&) = delete;
+    allocation_counter_t &operator=(allocation_counter_t &&) = delete;
+    allocation_counter_t &operator=(const allocation_counter_t &) = delete;
+
+  private:
+    benchmark::State &m_state;
+    size_t m_start;
+};
+
+} // namespace opengl_cpp::bench
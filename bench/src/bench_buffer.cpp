@@ -0,0 +1,35 @@
+#include "allocations.h"
+#include "gl_null.h"
+
+#include "opengl-cpp/buffer.h"
+#include <benchmark/benchmark.h>
+
+using namespace opengl_cpp;        // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::bench; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+// Builds and destroys the given amount of buffers per iteration.
+void buffer_build(benchmark::State &state) {
+    gl_null_t gl;
+    const auto amount = static_cast<size_t>(state.range(0));
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        auto buffers = buffer_t::build(gl, amount);
+        benchmark::DoNotOptimize(buffers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(buffer_build)->Arg(1)->Arg(16)->Arg(256);
+
+void buffer_construct(benchmark::State &state) {
+    gl_null_t gl;
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        buffer_t buffer(gl);
+        benchmark::DoNotOptimize(&buffer);
+    }
+}
+BENCHMARK(buffer_construct);
+
+} // namespace
@@ -0,0 +1,50 @@
+#include "allocations.h"
+#include "gl_null.h"
+
+#include "opengl-cpp/backend/gl_counters.h"
+#include <benchmark/benchmark.h>
+
+using namespace opengl_cpp;        // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::bench; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+// Baseline: the backend is known to the compiler, so the call is resolved and inlined away.
+void dispatch_direct(benchmark::State &state) {
+    gl_null_t gl;
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        gl.draw_arrays(0, 3);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(dispatch_direct);
+
+// The backend is hidden behind gl_t, as for the wrappers, so every call goes through the vtable.
+void dispatch_virtual(benchmark::State &state) {
+    gl_null_t null;
+    gl_t *gl = &null;
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gl);
+        gl->draw_arrays(0, 3);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(dispatch_virtual);
+
+// One decorator in front of the backend, i.e. two virtual calls and the decorator bookkeeping.
+void dispatch_decorated(benchmark::State &state) {
+    gl_null_t null;
+    gl_counters_t counters(null);
+    gl_t *gl = &counters;
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gl);
+        gl->draw_arrays(0, 3);
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(dispatch_decorated);
+
+} // namespace
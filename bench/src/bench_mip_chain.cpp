@@ -0,0 +1,123 @@
+#include "allocations.h"
+
+#include "opengl-cpp/backend/gl_impl.h"
+#include "opengl-cpp/backend/glfw_impl.h"
+#include "opengl-cpp/mip_chain.h"
+#include "opengl-cpp/texture.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace opengl_cpp;        // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::bench; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+constexpr uint64_t wait_timeout_ns = 1000000;
+
+std::vector<unsigned char> make_pixels(size_t side) {
+    std::vector<unsigned char> pixels(side * side * 4);
+    for (size_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<unsigned char>(i * 31);
+    }
+    return pixels;
+}
+
+// Hidden window owning the OpenGL context of the driver benchmarks, created on first use.
+class hidden_context_t {
+  public:
+    hidden_context_t() {
+        m_glfw.window_hint(GLFW_VISIBLE, GLFW_FALSE);
+        m_glfw.window_hint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        m_glfw.window_hint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        m_glfw.window_hint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        m_window = m_glfw.create_window(1, 1, "opengl_cpp_bench", nullptr, nullptr);
+        if (m_window != nullptr) {
+            m_glfw.make_context_current(m_window);
+            m_glfw.load_gl_loader();
+        }
+    }
+
+    ~hidden_context_t() {
+        if (m_window != nullptr) {
+            m_glfw.destroy_window(m_window);
+        }
+    }
+
+    hidden_context_t(const hidden_context_t &) = delete;
+    hidden_context_t(hidden_context_t &&) = delete;
+    hidden_context_t &operator=(const hidden_context_t &) = delete;
+    hidden_context_t &operator=(hidden_context_t &&) = delete;
+
+    // Gets the context, or nullptr when no window can be created, e.g. without a display.
+    static gl_t *get() {
+        static hidden_context_t context;
+        return context.m_window != nullptr ? &context.m_gl : nullptr;
+    }
+
+  private:
+    glfw_impl_t m_glfw;
+    GLFWwindow *m_window{};
+    gl_impl_t m_gl;
+};
+
+// Blocks until the GPU has run every command issued so far.
+void wait_for_gpu(gl_t &gl) {
+    auto *fence = gl.fence_sync();
+    while (gl.client_wait_sync(fence, wait_timeout_ns) == sync_status_t::timeout_expired) {
+    }
+    gl.destroy(fence);
+}
+
+// Builds the full chain of a square RGBA image, whose side is the argument.
+void mip_chain_build(benchmark::State &state, mip_filter_t filter) {
+    const auto side = static_cast<size_t>(state.range(0));
+    const auto pixels = make_pixels(side);
+    const mip_image_t image{pixels.data(), side, side, 4, true};
+
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        const mip_chain_t chain(image, filter);
+        benchmark::DoNotOptimize(&chain);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * pixels.size()));
+}
+BENCHMARK_CAPTURE(mip_chain_build, box, mip_filter_t::box)->Arg(256)->Arg(1024);
+BENCHMARK_CAPTURE(mip_chain_build, kaiser, mip_filter_t::kaiser)->Arg(256)->Arg(1024);
+
+// Fills every level of a texture until the GPU is done with it, either by building the chain with mip_chain_t and
+// uploading all the levels, or by uploading the base level and calling glGenerateMipmap. Wall time is measured, so
+// both the CPU and the driver side are accounted for. Skipped when no OpenGL context can be created.
+void mip_chain_vs_driver(benchmark::State &state, bool driver) {
+    auto *gl = hidden_context_t::get();
+    if (gl == nullptr) {
+        state.SkipWithError("no OpenGL context, e.g. no display available");
+        return;
+    }
+
+    const auto side = static_cast<size_t>(state.range(0));
+    const auto pixels = make_pixels(side);
+    const mip_image_t image{pixels.data(), side, side, 4, true};
+    const auto levels = texture_t::get_full_levels(side, side);
+
+    texture_t texture(*gl, 0, texture_target_t::tex_2d);
+    texture.bind();
+    texture.allocate(side, side, texture_internal_format_t::srgb8_alpha8, levels);
+    wait_for_gpu(*gl);
+
+    for (auto _ : state) {
+        if (driver) {
+            texture.set_sub_image(0, 0, 0, side, side, texture_format_t::rgba, pixels.data());
+            texture.generate_mipmap();
+        } else {
+            const mip_chain_t chain(image);
+            chain.upload(texture);
+        }
+        wait_for_gpu(*gl);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * pixels.size()));
+}
+BENCHMARK_CAPTURE(mip_chain_vs_driver, mip_chain, false)->Arg(256)->Arg(1024)->UseRealTime();
+BENCHMARK_CAPTURE(mip_chain_vs_driver, generate_mipmap, true)->Arg(256)->Arg(1024)->UseRealTime();
+
+} // namespace
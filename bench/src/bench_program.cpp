@@ -0,0 +1,67 @@
+#include "allocations.h"
+#include "gl_null.h"
+
+#include "opengl-cpp/program.h"
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace opengl_cpp;        // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::bench; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+// Links a program exposing the given amount of uniforms, named "u_0" onwards.
+program_t make_program(gl_null_t &gl, int uniforms) {
+    gl.set_active_uniforms(uniforms);
+    program_t program(gl);
+    program.link();
+    return program;
+}
+
+void program_set_uniform_char(benchmark::State &state) {
+    gl_null_t gl;
+    auto program = make_program(gl, static_cast<int>(state.range(0)));
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        program.set_uniform("u_0", 1.0F);
+    }
+}
+BENCHMARK(program_set_uniform_char)->Arg(1)->Arg(16)->Arg(64);
+
+// Name too long for the small string buffer, as in most real shaders, to check the lookup does not copy it.
+void program_set_uniform_string(benchmark::State &state) {
+    gl_null_t gl;
+    auto program = make_program(gl, 1);
+    const std::string name = "u_model_view_projection";
+    program.set_uniform(name, 1.0F); // Not active in the program, the first lookup adds it to the table.
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        program.set_uniform(name, 1.0F);
+    }
+}
+BENCHMARK(program_set_uniform_string);
+
+// Baseline: the location is looked up once, outside of the loop.
+void program_set_uniform_handle(benchmark::State &state) {
+    gl_null_t gl;
+    auto program = make_program(gl, 1);
+    const auto uniform = program.get_uniform("u_0");
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        program.set_uniform(uniform, 1.0F);
+    }
+}
+BENCHMARK(program_set_uniform_handle);
+
+void program_set_uniform_mat4(benchmark::State &state) {
+    gl_null_t gl;
+    auto program = make_program(gl, 1);
+    const glm::mat4 value(1.0F);
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        program.set_uniform("u_0", value);
+    }
+}
+BENCHMARK(program_set_uniform_mat4);
+
+} // namespace
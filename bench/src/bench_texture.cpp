@@ -0,0 +1,33 @@
+#include "allocations.h"
+#include "gl_null.h"
+
+#include "opengl-cpp/texture.h"
+#include <benchmark/benchmark.h>
+
+using namespace opengl_cpp;        // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::bench; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+// Activates the texture unit and binds the texture, two backend calls.
+void texture_bind(benchmark::State &state) {
+    gl_null_t gl;
+    texture_t texture(gl, 0, texture_target_t::tex_2d);
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        texture.bind();
+    }
+}
+BENCHMARK(texture_bind);
+
+void texture_construct(benchmark::State &state) {
+    gl_null_t gl;
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        texture_t texture(gl, 0, texture_target_t::tex_2d);
+        benchmark::DoNotOptimize(&texture);
+    }
+}
+BENCHMARK(texture_construct);
+
+} // namespace
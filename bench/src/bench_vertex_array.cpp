@@ -0,0 +1,48 @@
+#include "allocations.h"
+#include "gl_null.h"
+
+#include "opengl-cpp/vertex_array.h"
+#include <benchmark/benchmark.h>
+
+using namespace opengl_cpp;        // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::bench; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+// Constructs and destroys a vertex array per iteration, along with its vertex and index buffers.
+void vertex_array_construct(benchmark::State &state) {
+    gl_null_t gl;
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        vertex_array_t vertex_array(gl);
+        benchmark::DoNotOptimize(&vertex_array);
+    }
+}
+BENCHMARK(vertex_array_construct);
+
+// Moves a vertex array out and back in per iteration, one move construction and one move assignment.
+void vertex_array_move(benchmark::State &state) {
+    gl_null_t gl;
+    vertex_array_t vertex_array(gl);
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        vertex_array_t moved(std::move(vertex_array));
+        benchmark::DoNotOptimize(&moved);
+        vertex_array = std::move(moved);
+    }
+}
+BENCHMARK(vertex_array_move);
+
+void vertex_array_build(benchmark::State &state) {
+    gl_null_t gl;
+    const auto amount = static_cast<size_t>(state.range(0));
+    const allocation_counter_t allocations(state);
+    for (auto _ : state) {
+        auto vertex_arrays = vertex_array_t::build(gl, amount);
+        benchmark::DoNotOptimize(vertex_arrays.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(vertex_array_build)->Arg(1)->Arg(16)->Arg(256);
+
+} // namespace
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <opengl-cpp/backend/gl.h>
+
+namespace opengl_cpp::bench {
+
+/**
+ * @brief gl_t implementation doing nothing, so benchmarks measure the wrappers alone. Object names are counted up,
+ * programs link successfully and expose the uniforms "u_0" to "u_<n - 1>", n being set with set_active_uniforms().
+ */
+class gl_null_t final : public gl_t {
+  public:
+    gl_null_t() = default;
+    ~gl_null_t() override = default;
+
+    gl_null_t(const gl_null_t &) = delete;
+    gl_null_t(gl_null_t &&) = delete;
+    gl_null_t &operator=(gl_null_t &&) = delete;
+    gl_null_t &operator=(const gl_null_t &) = delete;
+
+    void set_active_uniforms(int count) {
+        m_active_uniforms = count;
+    }
+
+    // Allocators and deleters
+    id_program_t new_program() override {
+        return ++m_next_name;
+    }
+    id_shader_t new_shader(shader_type_t) override {
+        return ++m_next_name;
+    }
+    std::vector<id_buffer_t> new_buffers(size_t n) override {
+        return new_names<id_buffer_t>(n);
+    }
+    std::vector<id_texture_t> new_textures(size_t n) override {
+        return new_names<id_texture_t>(n);
+    }
+    std::vector<id_vertex_array_t> new_vertex_arrays(size_t n) override {
+        return new_names<id_vertex_array_t>(n);
+    }
+    std::vector<id_query_t> new_queries(size_t n) override {
+        return new_names<id_query_t>(n);
+    }
+    void destroy(size_t, const id_buffer_t *) override {
+    }
+    void destroy(const id_program_t &) override {
+    }
+    void destroy(const id_shader_t &) override {
+    }
+    void destroy(size_t, const id_texture_t *) override {
+    }
+    void destroy(size_t, const id_vertex_array_t *) override {
+    }
+    void destroy(size_t, const id_query_t *) override {
+    }
+    void destroy(sync_t) override {
+    }
+
+    // Texture functions
+    void activate(const texture_t &) override {
+    }
+    void bind(const texture_t &) override {
+    }
+    void generate_mipmap(const texture_t &) override {
+    }
+    void set_image(const texture_t &, size_t, size_t, texture_format_t, const unsigned char *) override {
+    }
+    void set_parameter(const texture_t &, texture_parameter_t, texture_parameter_values_t) override {
+    }
+    void set_sub_image(const texture_t &, int, size_t, size_t, size_t, size_t, texture_format_t, pixel_type_t,
+                       const void *) override {
+    }
+    void set_sub_image_3d(const texture_t &, int, size_t, size_t, size_t, size_t, size_t, size_t, texture_format_t,
+                          pixel_type_t, const void *) override {
+    }
+    void texture_storage(const texture_t &, size_t, texture_internal_format_t, size_t, size_t) override {
+    }
+    void texture_storage_3d(const texture_t &, size_t, texture_internal_format_t, size_t, size_t, size_t) override {
+    }
+    void compressed_image(const texture_t &, int, texture_internal_format_t, size_t, size_t, size_t,
+                          const void *) override {
+    }
+    void compressed_sub_image(const texture_t &, int, size_t, size_t, size_t, size_t, texture_internal_format_t, size_t,
+                              const void *) override {
+    }
+
+    // Program functions
+    void attach_shader(const program_t &, const shader_t &) override {
+    }
+    std::string get_active_uniform(const program_t &, unsigned index) override {
+        return "u_" + std::to_string(index);
+    }
+    std::string get_info_log(const program_t &) override {
+        return {};
+    }
+    int get_parameter(const program_t &, program_parameter_t param) override {
+        return param == program_parameter_t::active_uniforms ? m_active_uniforms : GL_TRUE;
+    }
+    program_binary_t get_program_binary(const program_t &) override {
+        return {};
+    }
+    int get_uniform_location(const program_t &, const char *) override {
+        return 0;
+    }
+    error_t link(const program_t &) override {
+        return error_t::no_error;
+    }
+    error_t program_binary(const program_t &, const program_binary_t &) override {
+        return error_t::no_error;
+    }
+    void set_parameter(const program_t &, program_parameter_t, int) override {
+    }
+    void use(const program_t &) override {
+    }
+    void set_uniform(int, float) override {
+    }
+    void set_uniform(int, int) override {
+    }
+    void set_uniform(int, const std::array<float, 3> &) override {
+    }
+    void set_uniform(int, const std::array<float, 4> &) override {
+    }
+    void set_uniform(int, const glm::vec3 &) override {
+    }
+    void set_uniform(int, const glm::mat4 &) override {
+    }
+
+    // Buffer functions
+    void bind(const buffer_t &) override {
+    }
+    void buffer_data(const buffer_t &, size_t, const void *, buffer_usage_t) override {
+    }
+    void buffer_sub_data(const buffer_t &, size_t, size_t, const void *) override {
+    }
+    void buffer_storage(const buffer_t &, size_t, const void *, buffer_access_t) override {
+    }
+    void *map_buffer_range(const buffer_t &, size_t, size_t, buffer_access_t) override {
+        return nullptr;
+    }
+    bool unmap_buffer(const buffer_t &) override {
+        return true;
+    }
+    void unbind(buffer_target_t) override {
+    }
+
+    // Synchronization functions
+    sync_t fence_sync() override {
+        return nullptr;
+    }
+    sync_status_t client_wait_sync(sync_t, uint64_t) override {
+        return sync_status_t::already_signaled;
+    }
+
+    // Query functions
+    uint64_t get_query_result(const id_query_t &) override {
+        return 0;
+    }
+    int64_t get_timestamp() override {
+        return 0;
+    }
+    bool is_query_result_available(const id_query_t &) override {
+        return true;
+    }
+    void query_counter(const id_query_t &) override {
+    }
+
+    // Vertex array functions
+    void bind(const vertex_array_t &) override {
+    }
+    void enable_vertex_attrib_array(unsigned) override {
+    }
+    void vertex_attrib_pointer(unsigned, size_t, size_t, unsigned) override {
+    }
+    void vertex_attrib_pointer(unsigned, size_t, vertex_attrib_type_t, bool, size_t, unsigned) override {
+    }
+    void vertex_attrib_divisor(unsigned, unsigned) override {
+    }
+
+    // Shader functions
+    error_t compile(const shader_t &) override {
+        return error_t::no_error;
+    }
+    std::string get_info_log(const shader_t &) override {
+        return {};
+    }
+    int get_parameter(const shader_t &, shader_parameter_t) override {
+        return GL_TRUE;
+    }
+    void set_sources(const shader_t &, size_t, const char **, const int *) override {
+    }
+
+    void clear() override {
+    }
+    void set_clear_color(const glm::vec4 &) override {
+    }
+    void disable(graphics_feature_t) override {
+    }
+    void draw_arrays(int, size_t) override {
+    }
+    void draw_arrays_instanced(int, size_t, size_t) override {
+    }
+    void draw_elements(size_t, index_type_t, size_t) override {
+    }
+    void draw_elements_instanced(size_t, index_type_t, size_t, size_t) override {
+    }
+    void multi_draw_arrays_indirect(size_t, size_t, size_t) override {
+    }
+    void multi_draw_elements_indirect(index_type_t, size_t, size_t, size_t) override {
+    }
+    void enable(graphics_feature_t) override {
+    }
+    std::string get_string(string_name_t) override {
+        return {};
+    }
+    bool has_extension(extension_t) override {
+        return false;
+    }
+    void max_shader_compiler_threads(unsigned) override {
+    }
+    void polygon_mode(polygon_mode_t) override {
+    }
+    void set_viewport(size_t, size_t) override {
+    }
+
+  private:
+    unsigned m_next_name{};
+    int m_active_uniforms{};
+
+    template <class id_t> std::vector<id_t> new_names(size_t n) {
+        std::vector<id_t> ret;
+        ret.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            ret.emplace_back(++m_next_name);
+        }
+        return ret;
+    }
+};
+
+} // namespace opengl_cpp::bench
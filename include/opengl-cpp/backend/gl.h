@@ -3,8 +3,10 @@
 #include "opengl-cpp/enumerates.h"
 #include "opengl-cpp/identifier_t.h"
 #include <array>
+#include <cstddef>
 #include <glm/glm.hpp>
 #include <string>
+#include <vector>
 
 namespace opengl_cpp {
 
@@ -15,6 +17,16 @@ class shader_t;
 class texture_t;
 class vertex_array_t;
 
+using sync_t = GLsync;
+
+/**
+ * @brief Linked program in the implementation-specific format returned by glGetProgramBinary.
+ */
+struct program_binary_t {
+    unsigned m_format;
+    std::vector<std::byte> m_data;
+};
+
 class gl_t {
   public:
     gl_t() = default;
@@ -69,8 +81,32 @@ class gl_t {
      * @param size Specifies the size in bytes of the buffer object's new data store.
      * @param data Specifies a pointer to data that will be copied into the data store for initialization, or NULL if no
      * data is to be copied.
+     * @param usage Specifies the expected usage pattern of the data store.
+     */
+    virtual void buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) = 0;
+
+    /**
+     * @brief updates a subset of a buffer object's data store.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferSubData.xhtml
+     * @param b Buffer target
+     * @param offset Specifies the offset into the buffer object's data store where data replacement will begin,
+     * measured in bytes.
+     * @param size Specifies the size in bytes of the data store region being replaced.
+     * @param data Specifies a pointer to the new data that will be copied into the data store.
+     */
+    virtual void buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) = 0;
+
+    /**
+     * @brief creates and initializes a buffer object's immutable data store.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferStorage.xhtml
+     * @param b Buffer target. Requires extension_t::buffer_storage.
+     * @param size Specifies the size in bytes of the buffer object's new data store.
+     * @param data Specifies a pointer to data that will be copied into the data store for initialization, or NULL if no
+     * data is to be copied.
+     * @param flags Specifies the intended usage of the buffer's data store, a combination of map_read, map_write,
+     * map_persistent, map_coherent, dynamic_storage and client_storage.
      */
-    virtual void buffer_data(const buffer_t &b, size_t size, const void *data) = 0;
+    virtual void buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) = 0;
 
     /**
      * @brief clear buffers to preset values.
@@ -86,6 +122,38 @@ class gl_t {
      */
     virtual void set_clear_color(const glm::vec4 &c) = 0;
 
+    /**
+     * @brief specify a two-dimensional texture image in a compressed format.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCompressedTexImage2D.xhtml
+     * @param t Texture whose target receives the image, it must be bound.
+     * @param level Specifies the level-of-detail number. Level 0 is the base image level.
+     * @param format Specifies the compressed format of the image data.
+     * @param width Specifies the width of the texture image.
+     * @param height Specifies the height of the texture image.
+     * @param size Specifies the number of unsigned bytes of image data starting at the address specified by data.
+     * @param data Specifies a pointer to the compressed image data in memory or, while a buffer is bound to
+     * GL_PIXEL_UNPACK_BUFFER, a byte offset into its data store.
+     */
+    virtual void compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width,
+                                  size_t height, size_t size, const void *data) = 0;
+
+    /**
+     * @brief specify a two-dimensional texture subimage in a compressed format.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCompressedTexSubImage2D.xhtml
+     * @param t Texture whose target receives the subimage, it must be bound.
+     * @param level Specifies the level-of-detail number. Level 0 is the base image level.
+     * @param x Specifies a texel offset in the x direction within the texture array, a multiple of the block width.
+     * @param y Specifies a texel offset in the y direction within the texture array, a multiple of the block height.
+     * @param width Specifies the width of the texture subimage.
+     * @param height Specifies the height of the texture subimage.
+     * @param format Specifies the compressed format of the image data, the one the texture was allocated with.
+     * @param size Specifies the number of unsigned bytes of image data starting at the address specified by data.
+     * @param data Specifies a pointer to the compressed image data in memory or, while a buffer is bound to
+     * GL_PIXEL_UNPACK_BUFFER, a byte offset into its data store.
+     */
+    virtual void compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                                      texture_internal_format_t format, size_t size, const void *data) = 0;
+
     /**
      * @brief Compiles a shader object.
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCompileShader.xhtml
@@ -146,6 +214,14 @@ class gl_t {
      */
     [[nodiscard]] virtual std::vector<id_vertex_array_t> new_vertex_arrays(size_t amount) = 0;
 
+    /**
+     * @brief generate query object names
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGenQueries.xhtml
+     * @param n Specifies the number of query object names to be generated.
+     * @return Generated queries.
+     */
+    virtual std::vector<id_query_t> new_queries(size_t n) = 0;
+
     /**
      * @brief delete named buffer objects.
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDeleteBuffers.xhtml
@@ -154,6 +230,13 @@ class gl_t {
      */
     virtual void destroy(size_t n, const id_buffer_t *buffers) = 0;
 
+    /**
+     * @brief delete a sync object.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDeleteSync.xhtml
+     * @param sync The sync object to be deleted.
+     */
+    virtual void destroy(sync_t sync) = 0;
+
     /**
      * @brief Deletes a program object.
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDeleteProgram.xhtml
@@ -184,6 +267,14 @@ class gl_t {
      */
     virtual void destroy(size_t n, const id_vertex_array_t *arrays) = 0;
 
+    /**
+     * @brief delete named query objects.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDeleteQueries.xhtml
+     * @param n Specifies the number of query objects to be deleted.
+     * @param queries Specifies an array of query objects to be deleted.
+     */
+    virtual void destroy(size_t n, const id_query_t *queries) = 0;
+
     /**
      * @brief enable or disable server-side GL capabilities. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glEnable.xhtml
@@ -191,6 +282,23 @@ class gl_t {
      */
     virtual void disable(graphics_feature_t cap) = 0;
 
+    /**
+     * @brief create a new sync object and insert it into the GL command stream.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glFenceSync.xhtml
+     * @return A sync object that becomes signaled once all the previous commands are completed.
+     */
+    virtual sync_t fence_sync() = 0;
+
+    /**
+     * @brief block and wait for a sync object to become signaled. Pending commands are flushed first.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glClientWaitSync.xhtml
+     * @param sync The sync object whose status to wait on.
+     * @param timeout The timeout, specified in nanoseconds, for which the implementation should wait for sync to become
+     * signaled.
+     * @return The status of the sync object when the wait ended.
+     */
+    virtual sync_status_t client_wait_sync(sync_t sync, uint64_t timeout) = 0;
+
     /**
      * @brief render primitives from array data. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawArrays.xhtml
@@ -200,11 +308,53 @@ class gl_t {
     virtual void draw_arrays(int first, size_t count) = 0;
 
     /**
-     * @brief render primitives from array data.
+     * @brief draw multiple instances of a range of elements. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawArraysInstanced.xhtml
+     * @param first Specifies the starting index in the enabled arrays.
+     * @param count Specifies the number of indices to be rendered.
+     * @param instances Specifies the number of instances of the specified range of indices to be rendered.
+     */
+    virtual void draw_arrays_instanced(int first, size_t count, size_t instances) = 0;
+
+    /**
+     * @brief render primitives from array data, reading the indices from the bound element array buffer. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawElements.xhtml
-     * @param indices Specifies a pointer to the location where the indices are stored.
+     * @param count Specifies the number of elements to be rendered.
+     * @param type Specifies the type of the values in the element array buffer.
+     * @param offset Specifies the offset in bytes of the first index inside the element array buffer.
+     */
+    virtual void draw_elements(size_t count, index_type_t type, size_t offset) = 0;
+
+    /**
+     * @brief draw multiple instances of a set of elements, reading the indices from the bound element array buffer. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawElementsInstanced.xhtml
+     * @param count Specifies the number of elements to be rendered.
+     * @param type Specifies the type of the values in the element array buffer.
+     * @param offset Specifies the offset in bytes of the first index inside the element array buffer.
+     * @param instances Specifies the number of instances of the specified range of indices to be rendered.
+     */
+    virtual void draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) = 0;
+
+    /**
+     * @brief render multiple sets of primitives from array data, with the draw parameters read from the bound draw
+     * indirect buffer. Requires extension_t::multi_draw_indirect. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMultiDrawArraysIndirect.xhtml
+     * @param offset Specifies the offset in bytes of the first command inside the draw indirect buffer.
+     * @param draw_count Specifies the number of draws to issue.
+     * @param stride Specifies the distance in bytes between commands, or 0 if they are tightly packed.
+     */
+    virtual void multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) = 0;
+
+    /**
+     * @brief render multiple sets of indexed primitives, with the draw parameters read from the bound draw indirect
+     * buffer. Requires extension_t::multi_draw_indirect. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMultiDrawElementsIndirect.xhtml
+     * @param type Specifies the type of the values in the element array buffer.
+     * @param offset Specifies the offset in bytes of the first command inside the draw indirect buffer.
+     * @param draw_count Specifies the number of draws to issue.
+     * @param stride Specifies the distance in bytes between commands, or 0 if they are tightly packed.
      */
-    virtual void draw_elements(const std::vector<unsigned> &indices) = 0;
+    virtual void multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) = 0;
 
     /**
      * @brief enable or disable server-side GL capabilities. See
@@ -227,6 +377,16 @@ class gl_t {
      */
     virtual void generate_mipmap(const texture_t &t) = 0;
 
+    /**
+     * @brief Returns the name of an active uniform variable for the specified program object
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetActiveUniform.xhtml
+     * @param p Specifies the program object to be queried.
+     * @param index Specifies the index of the uniform variable to be queried, between zero and the value of
+     * GL_ACTIVE_UNIFORMS minus one.
+     * @return Name of the uniform variable. Arrays are reported by the name of their first element, e.g. "arr[0]".
+     */
+    virtual std::string get_active_uniform(const program_t &p, unsigned index) = 0;
+
     /**
      * @brief Returns the information log for a program object
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetProgramInfoLog.xhtml
@@ -243,6 +403,21 @@ class gl_t {
      */
     virtual std::string get_info_log(const shader_t &s) = 0;
 
+    /**
+     * @brief return the result of a query object, waiting for it if it is not available yet. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetQueryObject.xhtml
+     * @param q Query whose result is returned.
+     * @return Query result, in nanoseconds for timer queries.
+     */
+    virtual uint64_t get_query_result(const id_query_t &q) = 0;
+
+    /**
+     * @brief return the current time of the GL server, once every previous command reached it but without waiting for
+     * them to complete. See https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGet.xhtml
+     * @return GL time in nanoseconds, in the same time base as timestamp queries.
+     */
+    virtual int64_t get_timestamp() = 0;
+
     /**
      * @brief Returns a parameter from a program object
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetProgram.xhtml
@@ -268,6 +443,24 @@ class gl_t {
      */
     virtual int get_parameter(const shader_t &s, shader_parameter_t param) = 0;
 
+    /**
+     * @brief return a binary representation of a program object's compiled and linked executable source. Requires
+     * extension_t::get_program_binary. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetProgramBinary.xhtml
+     * @param p Specifies the name of a program object whose binary representation to retrieve.
+     * @return Binary and its format, empty if the program has none.
+     */
+    virtual program_binary_t get_program_binary(const program_t &p) = 0;
+
+    /**
+     * @brief return a string describing the current GL connection. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetString.xhtml
+     * @param name Specifies a symbolic constant, one of GL_VENDOR, GL_RENDERER, GL_VERSION, or
+     * GL_SHADING_LANGUAGE_VERSION.
+     * @return Requested string.
+     */
+    virtual std::string get_string(string_name_t name) = 0;
+
     /**
      * @brief Returns the location of a uniform variable
      * @param p Specifies the program object to be queried.
@@ -277,6 +470,21 @@ class gl_t {
      */
     virtual int get_uniform_location(const program_t &p, const char *name) = 0;
 
+    /**
+     * @brief Checks if the context supports an extension.
+     * @param ext Extension to be checked.
+     * @return `true` if the extension entry points and enumerates can be used.
+     */
+    virtual bool has_extension(extension_t ext) = 0;
+
+    /**
+     * @brief check whether the result of a query object can be read without waiting. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetQueryObject.xhtml
+     * @param q Query to be checked.
+     * @return `true` if get_query_result() returns immediately.
+     */
+    virtual bool is_query_result_available(const id_query_t &q) = 0;
+
     /**
      * @brief Links a program object
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glLinkProgram.xhtml
@@ -284,6 +492,36 @@ class gl_t {
      */
     virtual error_t link(const program_t &p) = 0;
 
+    /**
+     * @brief load a program object with a program binary. Requires extension_t::get_program_binary. The program link
+     * status tells if the binary was accepted. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glProgramBinary.xhtml
+     * @param p Specifies the name of a program object into which to load a program binary.
+     * @param binary Binary, as returned by get_program_binary().
+     * @return Error raised while loading the binary, e.g. GL_INVALID_ENUM for an unsupported format.
+     */
+    virtual error_t program_binary(const program_t &p, const program_binary_t &binary) = 0;
+
+    /**
+     * @brief map all or part of a buffer object's data store into the client's address space.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMapBufferRange.xhtml
+     * @param b Buffer to be mapped, it must be bound.
+     * @param offset Specifies the starting offset within the buffer of the range to be mapped.
+     * @param length Specifies the length of the range to be mapped.
+     * @param access Specifies a combination of access flags indicating the desired access to the mapped range.
+     * @return Pointer to the mapped range, or NULL on failure.
+     */
+    virtual void *map_buffer_range(const buffer_t &b, size_t offset, size_t length, buffer_access_t access) = 0;
+
+    /**
+     * @brief Specify the number of threads the implementation may use to compile shaders and link programs. Does
+     * nothing without extension_t::parallel_shader_compile. See
+     * https://registry.khronos.org/OpenGL/extensions/KHR/KHR_parallel_shader_compile.txt
+     * @param count Maximum number of threads, 0 disables parallel compilation and 0xFFFFFFFF lets the implementation
+     * choose.
+     */
+    virtual void max_shader_compiler_threads(unsigned count) = 0;
+
     /**
      * @brief select a polygon rasterization mode. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glPolygonMode.xhtml
@@ -292,18 +530,27 @@ class gl_t {
      */
     virtual void polygon_mode(polygon_mode_t mode) = 0;
 
+    /**
+     * @brief record the GL time into a query object once every previous command is complete. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glQueryCounter.xhtml
+     * @param q Query receiving the GL_TIMESTAMP time.
+     */
+    virtual void query_counter(const id_query_t &q) = 0;
+
     /**
      * @brief Replaces the source code in a shader object
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glShaderSource.xhtml
      * @param shader Specifies the handle of the shader object whose source code is to be replaced.
      * @param num_sources Specifies the number of elements in the string and length arrays.
      * @param string Specifies an array of pointers to strings containing the source code to be loaded into the shader.
+     * @param lengths Specifies an array of string lengths, or nullptr if every string is null terminated.
      */
-    virtual void set_sources(const shader_t &s, size_t num_sources, const char **sources) = 0;
+    virtual void set_sources(const shader_t &s, size_t num_sources, const char **sources, const int *lengths) = 0;
 
     /**
      * @brief specify a two-dimensional texture_coord image
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
+     * @param t Texture whose target receives the image, it must be bound.
      * @param width Specifies the width of the texture_coord image. All implementations support texture_coord images
      * that are at least 1024 texels wide.
      * @param height Specifies the height of the texture_coord image, or the number of layers in a texture_coord array,
@@ -315,11 +562,13 @@ class gl_t {
      * GL_BGRA_INTEGER, GL_STENCIL_INDEX, GL_DEPTH_COMPONENT, GL_DEPTH_STENCIL.
      * @param data Specifies a pointer to the image data in memory.
      */
-    virtual void set_image(size_t width, size_t height, texture_format_t format, const unsigned char *data) = 0;
+    virtual void set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                           const unsigned char *data) = 0;
 
     /**
      * @brief set texture_coord parameters
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexParameter.xhtml
+     * @param t Texture whose target is modified, it must be bound.
      * @param name Specifies the symbolic name of a single-valued texture_coord parameter. pname can be one of the
 following: GL_DEPTH_STENCIL_TEXTURE_MODE, GL_TEXTURE_BASE_LEVEL, GL_TEXTURE_COMPARE_FUNC, GL_TEXTURE_COMPARE_MODE,
 GL_TEXTURE_LOD_BIAS, GL_TEXTURE_MIN_FILTER, GL_TEXTURE_MAG_FILTER, GL_TEXTURE_MIN_LOD, GL_TEXTURE_MAX_LOD,
@@ -328,7 +577,80 @@ GL_TEXTURE_WRAP_S, GL_TEXTURE_WRAP_T, or GL_TEXTURE_WRAP_R. For the vector comma
 be one of GL_TEXTURE_BORDER_COLOR or GL_TEXTURE_SWIZZLE_RGBA.
      * @param value For the scalar commands, specifies the value of pname.
      */
-    virtual void set_parameter(texture_parameter_t name, texture_parameter_values_t value) = 0;
+    virtual void set_parameter(const texture_t &t, texture_parameter_t name, texture_parameter_values_t value) = 0;
+
+    /**
+     * @brief specify a two-dimensional texture subimage.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexSubImage2D.xhtml
+     * @param t Texture whose target receives the subimage, it must be bound.
+     * @param level Specifies the level-of-detail number. Level 0 is the base image level.
+     * @param x Specifies a texel offset in the x direction within the texture array.
+     * @param y Specifies a texel offset in the y direction within the texture array.
+     * @param width Specifies the width of the texture subimage.
+     * @param height Specifies the height of the texture subimage.
+     * @param format Specifies the format of the pixel data.
+     * @param type Specifies the data type of the pixel data.
+     * @param data Specifies a pointer to the image data in memory or, while a buffer is bound to
+     * GL_PIXEL_UNPACK_BUFFER, a byte offset into its data store.
+     */
+    virtual void set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                               texture_format_t format, pixel_type_t type, const void *data) = 0;
+
+    /**
+     * @brief specify a three-dimensional texture subimage, e.g. layers of a two-dimensional texture array.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexSubImage3D.xhtml
+     * @param t Texture whose target receives the subimage, it must be bound.
+     * @param level Specifies the level-of-detail number. Level 0 is the base image level.
+     * @param x Specifies a texel offset in the x direction within the texture array.
+     * @param y Specifies a texel offset in the y direction within the texture array.
+     * @param z Specifies a texel offset in the z direction within the texture array, i.e. the first layer.
+     * @param width Specifies the width of the texture subimage.
+     * @param height Specifies the height of the texture subimage.
+     * @param depth Specifies the depth of the texture subimage, i.e. the number of layers.
+     * @param format Specifies the format of the pixel data.
+     * @param type Specifies the data type of the pixel data.
+     * @param data Specifies a pointer to the image data in memory or, while a buffer is bound to
+     * GL_PIXEL_UNPACK_BUFFER, a byte offset into its data store.
+     */
+    virtual void set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width,
+                                  size_t height, size_t depth, texture_format_t format, pixel_type_t type,
+                                  const void *data) = 0;
+
+    /**
+     * @brief simultaneously specify storage for all levels of a two-dimensional texture. Without
+     * extension_t::texture_storage, each level is allocated with glTexImage2D instead, so the storage is still
+     * complete but not immutable. See https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexStorage2D.xhtml
+     * @param t Texture whose target receives the storage, it must be bound.
+     * @param levels Specify the number of texture levels.
+     * @param format Specifies the sized internal format to be used to store texture image data.
+     * @param width Specifies the width of the texture, in texels.
+     * @param height Specifies the height of the texture, in texels.
+     */
+    virtual void texture_storage(const texture_t &t, size_t levels, texture_internal_format_t format, size_t width,
+                                 size_t height) = 0;
+
+    /**
+     * @brief simultaneously specify storage for all levels of a two-dimensional array texture. Without
+     * extension_t::texture_storage, each level is allocated with glTexImage3D instead. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexStorage3D.xhtml
+     * @param t Texture whose target receives the storage, it must be bound.
+     * @param levels Specify the number of texture levels.
+     * @param format Specifies the sized internal format to be used to store texture image data.
+     * @param width Specifies the width of the texture, in texels.
+     * @param height Specifies the height of the texture, in texels.
+     * @param depth Specifies the number of layers of the array texture.
+     */
+    virtual void texture_storage_3d(const texture_t &t, size_t levels, texture_internal_format_t format, size_t width,
+                                    size_t height, size_t depth) = 0;
+
+    /**
+     * @brief specify a parameter for a program object. Requires extension_t::get_program_binary. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glProgramParameter.xhtml
+     * @param p Specifies the name of a program object whose parameter to modify.
+     * @param param Specifies the name of the parameter to modify, e.g. GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+     * @param value Specifies the new value of the parameter.
+     */
+    virtual void set_parameter(const program_t &p, program_parameter_t param, int value) = 0;
 
     /**
      * @brief Specify the value of a uniform variable for the current program object.
@@ -383,6 +705,21 @@ be one of GL_TEXTURE_BORDER_COLOR or GL_TEXTURE_SWIZZLE_RGBA.
      */
     virtual void set_uniform(int location, const glm::mat4 &value) = 0;
 
+    /**
+     * @brief release the mapping of a buffer object's data store into the client's address space.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glUnmapBuffer.xhtml
+     * @param b Buffer to be unmapped, it must be bound.
+     * @return `false` if the data store contents have become corrupt during the time the data store was mapped.
+     */
+    virtual bool unmap_buffer(const buffer_t &b) = 0;
+
+    /**
+     * @brief break the existing binding of a buffer target, binding zero to it.
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBindBuffer.xhtml
+     * @param target Specifies the target to which no buffer will be bound.
+     */
+    virtual void unbind(buffer_target_t target) = 0;
+
     /**
      * @brief Installs a program object as part of current rendering state
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glUseProgram.xhtml
@@ -404,6 +741,31 @@ be one of GL_TEXTURE_BORDER_COLOR or GL_TEXTURE_SWIZZLE_RGBA.
      */
     virtual void vertex_attrib_pointer(unsigned index, size_t size, size_t stride, unsigned offset) = 0;
 
+    /**
+     * @brief define an array of generic vertex attribute data of any component type. Integer components are converted
+     * to floating point, mapped to [0, 1] or [-1, 1] when normalized. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glVertexAttribPointer.xhtml
+     * @param index Specifies the index of the generic vertex attribute to be modified.
+     * @param size Specifies the number of components per generic vertex attribute. Must be 1, 2, 3, 4, and 4 for the
+     * packed types.
+     * @param type Specifies the data type of each component in the array.
+     * @param normalized Specifies whether fixed-point data values should be normalized.
+     * @param stride Specifies the byte offset between consecutive generic vertex attributes.
+     * @param offset Specifies a offset of the first component of the first generic vertex attribute in the array in
+     * the data store of the buffer currently bound to the GL_ARRAY_BUFFER target.
+     */
+    virtual void vertex_attrib_pointer(unsigned index, size_t size, vertex_attrib_type_t type, bool normalized,
+                                       size_t stride, unsigned offset) = 0;
+
+    /**
+     * @brief modify the rate at which generic vertex attributes advance during instanced rendering. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glVertexAttribDivisor.xhtml
+     * @param index Specifies the index of the generic vertex attribute.
+     * @param divisor Specifies the number of instances that will pass between updates of the generic attribute at
+     * slot index. Zero makes the attribute advance once per vertex.
+     */
+    virtual void vertex_attrib_divisor(unsigned index, unsigned divisor) = 0;
+
     /**
      * @brief set the viewport
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glViewport.xhtml
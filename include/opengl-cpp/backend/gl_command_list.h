@@ -0,0 +1,160 @@
+#pragma once
+
+#include "gl.h"
+#include <cstddef>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief gl_t implementation that does not touch OpenGL. Calls are recorded into a linear stream of POD commands, with
+ * their variable-sized payloads (buffer data, indices, shader sources...) copied into an arena, and can be replayed
+ * later onto another gl_t.
+ *
+ * Command lists do not share any state, so each thread can record its own one and hand it over to the thread owning
+ * the context for replay. Objects are recorded by address, so the buffers, textures, programs, shaders and vertex
+ * arrays referenced by a command list must stay alive and must not be moved until it has been replayed.
+ *
+ * Pixel data passed while a buffer_target_t::pixel_unpack buffer is bound is an offset into that buffer, so it is
+ * recorded as is instead of being copied.
+ *
+ * Calls that return a value from the context (object creation, compile, link and queries) cannot be deferred and throw
+ * std::logic_error.
+ */
+class gl_command_list_t : public gl_t {
+  public:
+    gl_command_list_t() = default;
+    ~gl_command_list_t() override = default;
+
+    gl_command_list_t(const gl_command_list_t &) = delete;
+    gl_command_list_t(gl_command_list_t &&) = delete;
+    gl_command_list_t &operator=(gl_command_list_t &&) = delete;
+    gl_command_list_t &operator=(const gl_command_list_t &) = delete;
+
+    /**
+     * @brief Issues every recorded command, in order, on another gl_t. The command list is left untouched, so it can
+     * be replayed again.
+     * @param gl Where the commands are issued, usually a gl_impl_t.
+     */
+    void replay(gl_t &gl) const;
+
+    /**
+     * @brief Drops every recorded command. The memory is kept, so recording the next frame does not allocate.
+     */
+    void reset();
+
+    /**
+     * @brief Checks if there are recorded commands.
+     * @return `true` if nothing was recorded since the last reset.
+     */
+    [[nodiscard]] bool empty() const;
+
+    // Allocators and deleters
+    id_program_t new_program() override;
+    id_shader_t new_shader(shader_type_t type) override;
+    std::vector<id_buffer_t> new_buffers(size_t n) override;
+    std::vector<id_texture_t> new_textures(size_t n) override;
+    std::vector<id_vertex_array_t> new_vertex_arrays(size_t n) override;
+    std::vector<id_query_t> new_queries(size_t n) override;
+    void destroy(size_t n, const id_buffer_t *buffers) override;
+    void destroy(const id_program_t &program) override;
+    void destroy(const id_shader_t &shader) override;
+    void destroy(size_t n, const id_texture_t *textures) override;
+    void destroy(size_t n, const id_vertex_array_t *arrays) override;
+    void destroy(size_t n, const id_query_t *queries) override;
+    void destroy(sync_t sync) override;
+
+    // Texture functions
+    void activate(const texture_t &tex) override;
+    void bind(const texture_t &t) override;
+    void generate_mipmap(const texture_t &t) override;
+    void set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                   const unsigned char *data) override;
+    void set_parameter(const texture_t &t, texture_parameter_t name, texture_parameter_values_t value) override;
+    void set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                       texture_format_t format, pixel_type_t type, const void *data) override;
+    void set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width, size_t height,
+                          size_t depth, texture_format_t format, pixel_type_t type, const void *data) override;
+    void texture_storage(const texture_t &t, size_t levels, texture_internal_format_t format, size_t width,
+                         size_t height) override;
+    void texture_storage_3d(const texture_t &t, size_t levels, texture_internal_format_t format, size_t width,
+                            size_t height, size_t depth) override;
+    void compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width, size_t height,
+                          size_t size, const void *data) override;
+    void compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                              texture_internal_format_t format, size_t size, const void *data) override;
+
+    // Program functions
+    void attach_shader(const program_t &p, const shader_t &s) override;
+    std::string get_active_uniform(const program_t &p, unsigned index) override;
+    std::string get_info_log(const program_t &p) override;
+    int get_parameter(const program_t &p, program_parameter_t param) override;
+    program_binary_t get_program_binary(const program_t &p) override;
+    int get_uniform_location(const program_t &p, const char *name) override;
+    error_t link(const program_t &p) override;
+    error_t program_binary(const program_t &p, const program_binary_t &binary) override;
+    void set_parameter(const program_t &p, program_parameter_t param, int value) override;
+    void use(const program_t &p) override;
+    void set_uniform(int location, float v0) override;
+    void set_uniform(int location, int v0) override;
+    void set_uniform(int location, const std::array<float, 3> &v) override;
+    void set_uniform(int location, const std::array<float, 4> &v) override;
+    void set_uniform(int location, const glm::vec3 &value) override;
+    void set_uniform(int location, const glm::mat4 &value) override;
+
+    // Buffer functions
+    void bind(const buffer_t &b) override;
+    void buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) override;
+    void buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) override;
+    void buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) override;
+    void *map_buffer_range(const buffer_t &b, size_t offset, size_t length, buffer_access_t access) override;
+    bool unmap_buffer(const buffer_t &b) override;
+    void unbind(buffer_target_t target) override;
+
+    // Synchronization functions
+    sync_t fence_sync() override;
+    sync_status_t client_wait_sync(sync_t sync, uint64_t timeout) override;
+
+    // Query functions
+    uint64_t get_query_result(const id_query_t &q) override;
+    int64_t get_timestamp() override;
+    bool is_query_result_available(const id_query_t &q) override;
+    void query_counter(const id_query_t &q) override;
+
+    // Vertex array functions
+    void bind(const vertex_array_t &va) override;
+    void enable_vertex_attrib_array(unsigned index) override;
+    void vertex_attrib_pointer(unsigned index, size_t size, size_t stride, unsigned offset) override;
+    void vertex_attrib_pointer(unsigned index, size_t size, vertex_attrib_type_t type, bool normalized, size_t stride,
+                               unsigned offset) override;
+    void vertex_attrib_divisor(unsigned index, unsigned divisor) override;
+
+    // Shader functions
+    error_t compile(const shader_t &s) override;
+    std::string get_info_log(const shader_t &s) override;
+    int get_parameter(const shader_t &s, shader_parameter_t param) override;
+    void set_sources(const shader_t &s, size_t num_sources, const char **sources, const int *lengths) override;
+
+    void clear() override;
+    void set_clear_color(const glm::vec4 &c) override;
+    void disable(graphics_feature_t cap) override;
+    void draw_arrays(int first, size_t count) override;
+    void draw_arrays_instanced(int first, size_t count, size_t instances) override;
+    void draw_elements(size_t count, index_type_t type, size_t offset) override;
+    void draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) override;
+    void multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) override;
+    void multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) override;
+    void enable(graphics_feature_t cap) override;
+    std::string get_string(string_name_t name) override;
+    bool has_extension(extension_t ext) override;
+    void max_shader_compiler_threads(unsigned count) override;
+    void polygon_mode(polygon_mode_t mode) override;
+    void set_viewport(size_t width, size_t height) override;
+
+  private:
+    std::vector<std::byte> m_commands;
+    std::vector<std::byte> m_arena;
+    bool m_pixel_unpack_bound{}; // Pixel data is an offset into the unpack buffer rather than client memory.
+};
+
+} // namespace opengl_cpp
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "gl_decorator.h"
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Amount of work issued through a gl_counters_t during one frame.
+ */
+struct gl_frame_counters_t {
+    size_t m_frame;
+    size_t m_draw_calls;
+    size_t m_vertices;
+    size_t m_buffer_binds;
+    size_t m_texture_binds;
+    size_t m_vertex_array_binds;
+    size_t m_program_switches;
+    size_t m_uniform_updates;
+    size_t m_buffer_bytes;
+    size_t m_texture_bytes;
+    size_t m_objects_created;
+    size_t m_objects_destroyed;
+};
+
+/**
+ * @brief gl_t decorator counting, per frame, the calls and bytes going through it, to see at a glance what changed
+ * when a frame regresses.
+ *
+ * Vertices are counted once per instance. Indirect draws count as one draw call per command, their vertices being
+ * unknown on the CPU. Program switches only count use() calls changing the current program. Texture bytes are the
+ * size of the pixels passed, without row padding, compressed uploads counting their compressed size. Objects are
+ * counted per name, whatever their type.
+ *
+ * Counters are only touched by the thread owning the context, so they are not synchronized.
+ */
+class gl_counters_t : public gl_decorator_t {
+  public:
+    /**
+     * @brief Default amount of finished frames kept.
+     */
+    static constexpr size_t default_history = 120;
+
+    /**
+     * @brief Creates a counter around another gl_t.
+     * @param gl Decorated gl_t, must outlive the counter.
+     * @param history Amount of finished frames kept, the oldest ones being dropped first.
+     */
+    explicit gl_counters_t(gl_t &gl, size_t history = default_history);
+    ~gl_counters_t() override = default;
+
+    gl_counters_t(const gl_counters_t &) = delete;
+    gl_counters_t(gl_counters_t &&) = delete;
+    gl_counters_t &operator=(gl_counters_t &&) = delete;
+    gl_counters_t &operator=(const gl_counters_t &) = delete;
+
+    /**
+     * @brief Finishes the current frame, moving its counters into the history, and starts counting the next one.
+     * Meant to be called once per frame, e.g. right after swapping buffers.
+     */
+    void end_frame();
+
+    /**
+     * @brief Gets the counters of the frame in progress.
+     * @return Counters so far.
+     */
+    [[nodiscard]] const gl_frame_counters_t &get_current() const;
+
+    /**
+     * @brief Gets a snapshot of the counters of the finished frames.
+     * @return Counters, oldest frame first.
+     */
+    [[nodiscard]] std::vector<gl_frame_counters_t> get_history() const;
+
+    /**
+     * @brief Writes the counters of the finished frames as CSV, one row per frame after a header row.
+     * @param os Where the rows are written.
+     */
+    void write_csv(std::ostream &os) const;
+
+    /**
+     * @brief Writes the counters of the finished frames into a CSV file, see the overload above.
+     * @param path File to be written.
+     * @throws std::runtime_error When the file cannot be written.
+     */
+    void write_csv(const std::filesystem::path &path) const;
+
+    // Allocators and deleters
+    id_program_t new_program() override;
+    id_shader_t new_shader(shader_type_t type) override;
+    std::vector<id_buffer_t> new_buffers(size_t n) override;
+    std::vector<id_texture_t> new_textures(size_t n) override;
+    std::vector<id_vertex_array_t> new_vertex_arrays(size_t n) override;
+    std::vector<id_query_t> new_queries(size_t n) override;
+    void destroy(size_t n, const id_buffer_t *buffers) override;
+    void destroy(const id_program_t &program) override;
+    void destroy(const id_shader_t &shader) override;
+    void destroy(size_t n, const id_texture_t *textures) override;
+    void destroy(size_t n, const id_vertex_array_t *arrays) override;
+    void destroy(size_t n, const id_query_t *queries) override;
+
+    // Binds
+    void bind(const buffer_t &b) override;
+    void bind(const texture_t &t) override;
+    void bind(const vertex_array_t &va) override;
+    void use(const program_t &p) override;
+
+    // Uploads
+    void buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) override;
+    void buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) override;
+    void buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) override;
+    void compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width, size_t height,
+                          size_t size, const void *data) override;
+    void compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                              texture_internal_format_t format, size_t size, const void *data) override;
+    void set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                   const unsigned char *data) override;
+    void set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                       texture_format_t format, pixel_type_t type, const void *data) override;
+    void set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width, size_t height,
+                          size_t depth, texture_format_t format, pixel_type_t type, const void *data) override;
+
+    // Draws
+    void draw_arrays(int first, size_t count) override;
+    void draw_arrays_instanced(int first, size_t count, size_t instances) override;
+    void draw_elements(size_t count, index_type_t type, size_t offset) override;
+    void draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) override;
+    void multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) override;
+    void multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) override;
+
+    // Uniforms
+    void set_uniform(int location, float v0) override;
+    void set_uniform(int location, int v0) override;
+    void set_uniform(int location, const glm::vec3 &v) override;
+    void set_uniform(int location, const std::array<float, 3> &v) override;
+    void set_uniform(int location, const std::array<float, 4> &v) override;
+    void set_uniform(int location, const glm::mat4 &value) override;
+
+  private:
+    size_t m_max_history;
+    gl_frame_counters_t m_current{};
+    std::deque<gl_frame_counters_t> m_history;
+    std::optional<unsigned> m_program;
+};
+
+std::ostream &operator<<(std::ostream &os, const gl_counters_t &c);
+
+} // namespace opengl_cpp
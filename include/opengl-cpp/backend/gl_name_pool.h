@@ -0,0 +1,70 @@
+#pragma once
+
+#include "gl_decorator.h"
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief gl_t decorator that hands out buffer, texture and vertex array names from per-type pools, generated in
+ * batches, and defers their deletion to flush(), where every name released since the previous flush is deleted with
+ * one call per type.
+ *
+ * Released names are not handed out again directly, as the objects behind them keep their storage and attribute
+ * setup, which the next owner must not inherit. They become available again once flush() deleted them, and the
+ * implementation is free to return them on the next batched generation.
+ */
+class gl_name_pool_t : public gl_decorator_t {
+  public:
+    /**
+     * @brief Default amount of names generated at once when a pool runs dry.
+     */
+    static constexpr size_t default_batch_size = 64;
+
+    /**
+     * @brief Creates a name pool around another gl_t. No name is generated until the first request.
+     * @param gl Decorated gl_t, must outlive the pool.
+     * @param batch_size Amount of names generated at once when a pool runs dry.
+     */
+    explicit gl_name_pool_t(gl_t &gl, size_t batch_size = default_batch_size);
+
+    /**
+     * @brief Deletes the released names and the ones still pooled.
+     */
+    ~gl_name_pool_t() override;
+
+    gl_name_pool_t(const gl_name_pool_t &) = delete;
+    gl_name_pool_t(gl_name_pool_t &&) = delete;
+    gl_name_pool_t &operator=(gl_name_pool_t &&) = delete;
+    gl_name_pool_t &operator=(const gl_name_pool_t &) = delete;
+
+    /**
+     * @brief Deletes the names released since the previous flush, with one call per type. Meant to be called once per
+     * frame, e.g. right after swapping buffers.
+     */
+    void flush();
+
+    /**
+     * @brief Gets the amount of names waiting for the next flush.
+     * @return Released names of every type.
+     */
+    [[nodiscard]] size_t get_released() const;
+
+    std::vector<id_buffer_t> new_buffers(size_t n) override;
+    std::vector<id_texture_t> new_textures(size_t n) override;
+    std::vector<id_vertex_array_t> new_vertex_arrays(size_t n) override;
+    void destroy(size_t n, const id_buffer_t *buffers) override;
+    void destroy(size_t n, const id_texture_t *textures) override;
+    void destroy(size_t n, const id_vertex_array_t *arrays) override;
+
+  private:
+    size_t m_batch_size;
+    std::vector<id_buffer_t> m_free_buffers;
+    std::vector<id_texture_t> m_free_textures;
+    std::vector<id_vertex_array_t> m_free_vertex_arrays;
+    std::vector<id_buffer_t> m_released_buffers;
+    std::vector<id_texture_t> m_released_textures;
+    std::vector<id_vertex_array_t> m_released_vertex_arrays;
+};
+
+} // namespace opengl_cpp
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "gl_decorator.h"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief gl_t decorator timing named scopes on both the CPU and the GPU, exported as a Chrome trace.
+ *
+ * Every scope is timed on the CPU with std::chrono::steady_clock, and on the GPU with a pair of GL_TIMESTAMP queries
+ * taken from a ring allocated up front. Timestamps are used rather than GL_TIME_ELAPSED queries, which cannot be
+ * nested. collect() reads back the results that are already available, oldest first, and never waits for the GPU:
+ * scopes whose results are not there yet are left for a later call. When the ring is full, scopes are only timed on
+ * the CPU, see get_dropped().
+ *
+ * Draw and upload calls going through the profiler are counted in every enclosing scope, so each event tells how much
+ * work it issued.
+ *
+ * GPU times are converted to the CPU time base with the offset measured by synchronize_clocks(), so both timelines can
+ * be compared side by side. Scopes must be opened and closed on the thread owning the context.
+ */
+class gl_profiler_t : public gl_decorator_t {
+  public:
+    /**
+     * @brief Default amount of timestamp queries in the ring, two per GPU scope in flight.
+     */
+    static constexpr size_t default_query_capacity = 256;
+
+    enum class track_t { cpu, gpu };
+
+    /**
+     * @brief Timed scope. Times are in nanoseconds, starts being relative to the creation of the profiler.
+     */
+    struct event_t {
+        std::string m_name;
+        track_t m_track;
+        int64_t m_start;
+        int64_t m_duration;
+        size_t m_depth;
+        size_t m_draws;
+        size_t m_uploads;
+        size_t m_upload_bytes;
+    };
+
+    /**
+     * @brief Scope opened on construction and closed on destruction.
+     */
+    class scope_t {
+      public:
+        scope_t(gl_profiler_t &profiler, std::string name);
+        ~scope_t();
+
+        scope_t(const scope_t &) = delete;
+        scope_t(scope_t &&) = delete;
+        scope_t &operator=(scope_t &&) = delete;
+        scope_t &operator=(const scope_t &) = delete;
+
+      private:
+        gl_profiler_t &m_profiler;
+    };
+
+    /**
+     * @brief Creates a profiler around another gl_t, generates its queries and synchronizes the clocks.
+     * @param gl Decorated gl_t, must outlive the profiler.
+     * @param query_capacity Amount of timestamp queries in the ring, at least 2.
+     */
+    explicit gl_profiler_t(gl_t &gl, size_t query_capacity = default_query_capacity);
+
+    /**
+     * @brief Deletes the queries. Scopes still waiting for their GPU times are lost.
+     */
+    ~gl_profiler_t() override;
+
+    gl_profiler_t(const gl_profiler_t &) = delete;
+    gl_profiler_t(gl_profiler_t &&) = delete;
+    gl_profiler_t &operator=(gl_profiler_t &&) = delete;
+    gl_profiler_t &operator=(const gl_profiler_t &) = delete;
+
+    /**
+     * @brief Opens a scope, nested in the scopes already open. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glQueryCounter.xhtml
+     * @param name Name of the scope in the trace.
+     */
+    void begin_scope(std::string name);
+
+    /**
+     * @brief Closes the scope opened last.
+     */
+    void end_scope();
+
+    /**
+     * @brief Reads back the GPU times of the closed scopes whose queries are available, without waiting. Meant to be
+     * called once per frame, e.g. right after swapping buffers.
+     */
+    void collect();
+
+    /**
+     * @brief Measures again the offset between the GPU and the CPU clocks, which may drift over long sessions.
+     */
+    void synchronize_clocks();
+
+    /**
+     * @brief Drops the collected events, e.g. after they were written.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the collected events, CPU events in the order their scopes were closed and GPU events in the order
+     * their scopes were opened.
+     * @return Events.
+     */
+    [[nodiscard]] const std::vector<event_t> &get_events() const;
+
+    /**
+     * @brief Gets the amount of GPU scopes whose times were not collected yet.
+     * @return Scopes in flight.
+     */
+    [[nodiscard]] size_t get_pending() const;
+
+    /**
+     * @brief Gets the amount of scopes only timed on the CPU because the query ring was full.
+     * @return Dropped GPU scopes.
+     */
+    [[nodiscard]] size_t get_dropped() const;
+
+    /**
+     * @brief Writes the collected events in the Chrome trace event format, to be opened with about:tracing or
+     * https://ui.perfetto.dev, the CPU and GPU timelines being two threads of the same process.
+     * @param os Where the trace is written.
+     */
+    void write_trace(std::ostream &os) const;
+
+    /**
+     * @brief Writes the collected events into a Chrome trace file, see the overload above.
+     * @param path File to be written.
+     * @throws std::runtime_error When the file cannot be written.
+     */
+    void write_trace(const std::filesystem::path &path) const;
+
+    void buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) override;
+    void buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) override;
+    void buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) override;
+    void compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width, size_t height,
+                          size_t size, const void *data) override;
+    void compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                              texture_internal_format_t format, size_t size, const void *data) override;
+    void set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                   const unsigned char *data) override;
+    void set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                       texture_format_t format, pixel_type_t type, const void *data) override;
+    void set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width, size_t height,
+                          size_t depth, texture_format_t format, pixel_type_t type, const void *data) override;
+    void draw_arrays(int first, size_t count) override;
+    void draw_arrays_instanced(int first, size_t count, size_t instances) override;
+    void draw_elements(size_t count, index_type_t type, size_t offset) override;
+    void draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) override;
+    void multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) override;
+    void multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) override;
+
+  private:
+    struct counters_t {
+        size_t m_draws;
+        size_t m_uploads;
+        size_t m_upload_bytes;
+    };
+
+    struct open_scope_t {
+        std::string m_name;
+        int64_t m_start;
+        counters_t m_counters;
+        std::optional<uint64_t> m_query_pair;
+    };
+
+    struct gpu_scope_t {
+        std::string m_name;
+        size_t m_depth;
+        bool m_closed;
+        counters_t m_counters;
+    };
+
+    std::chrono::steady_clock::time_point m_epoch;
+    int64_t m_gpu_offset{};
+    std::vector<id_query_t> m_queries;
+    std::vector<gpu_scope_t> m_gpu_scopes;
+    uint64_t m_next_pair{};
+    uint64_t m_oldest_pair{};
+    size_t m_dropped{};
+    std::vector<open_scope_t> m_open_scopes;
+    std::vector<event_t> m_events;
+
+    [[nodiscard]] int64_t now() const;
+    void count_draw();
+    void count_upload(size_t bytes);
+};
+
+std::ostream &operator<<(std::ostream &os, const gl_profiler_t &p);
+
+} // namespace opengl_cpp
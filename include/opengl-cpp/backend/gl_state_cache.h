@@ -0,0 +1,59 @@
+#pragma once
+
+#include "gl_decorator.h"
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+namespace opengl_cpp {
+
+/**
+ * @brief gl_t decorator that shadows the current program, vertex array, buffer bindings, active texture unit and
+ * texture bindings, dropping the calls that would not change any of them.
+ *
+ * Every GL call that changes binding state must go through this object, otherwise the shadow state gets out of sync.
+ * When that cannot be guaranteed (e.g. third-party code touching the context), call invalidate() afterwards.
+ */
+class gl_state_cache_t : public gl_decorator_t {
+  public:
+    /**
+     * @brief Creates a state cache around another gl_t. The initial state is unknown, so the first call of each kind
+     * always reaches the decorated gl_t.
+     * @param gl Decorated gl_t, must outlive the cache.
+     */
+    explicit gl_state_cache_t(gl_t &gl);
+    ~gl_state_cache_t() override = default;
+
+    gl_state_cache_t(const gl_state_cache_t &) = delete;
+    gl_state_cache_t(gl_state_cache_t &&) = delete;
+    gl_state_cache_t &operator=(gl_state_cache_t &&) = delete;
+    gl_state_cache_t &operator=(const gl_state_cache_t &) = delete;
+
+    /**
+     * @brief Forgets all the shadowed state, so the next call of each kind reaches the decorated gl_t.
+     */
+    void invalidate();
+
+    void destroy(size_t n, const id_buffer_t *buffers) override;
+    void destroy(const id_program_t &program) override;
+    void destroy(size_t n, const id_texture_t *textures) override;
+    void destroy(size_t n, const id_vertex_array_t *arrays) override;
+
+    void activate(const texture_t &tex) override;
+    void bind(const texture_t &t) override;
+    void use(const program_t &p) override;
+    void bind(const buffer_t &b) override;
+    void unbind(buffer_target_t target) override;
+    void bind(const vertex_array_t &va) override;
+
+  private:
+    std::optional<unsigned> m_program;
+    std::optional<unsigned> m_vertex_array;
+    std::optional<int> m_active_unit;
+    std::unordered_map<buffer_target_t, unsigned> m_buffers;
+    std::unordered_map<uint64_t, unsigned> m_textures;
+
+    static uint64_t texture_key(int unit, texture_target_t target);
+};
+
+} // namespace opengl_cpp
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "opengl-cpp/backend/gl.h"
+#include <cassert>
 #include <ostream>
 #include <vector>
 
@@ -61,8 +62,66 @@ class buffer_t {
      * @param data Data to be stored.
      * @param usage Expected usage pattern of the data store.
      */
-    template <class type_t> void load(const std::vector<type_t> &data) {
-        m_gl.buffer_data(*this, data.size() * sizeof(type_t), data.data());
+    template <class type_t>
+    void load(const std::vector<type_t> &data, buffer_usage_t usage = buffer_usage_t::static_draw) {
+        load(data.data(), data.size() * sizeof(type_t), usage);
+    }
+
+    /**
+     * @brief Creates and initializes a buffer object data storage from raw memory, such as a mapped file. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferData.xhtml
+     *
+     * @param data Data to be stored.
+     * @param size Size of the data in bytes.
+     * @param usage Expected usage pattern of the data store.
+     */
+    void load(const void *data, size_t size, buffer_usage_t usage = buffer_usage_t::static_draw);
+
+    /**
+     * @brief Creates a buffer object data storage without initializing it, to be filled later with update(). See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferData.xhtml
+     *
+     * @param size Size of the data store in bytes.
+     * @param usage Expected usage pattern of the data store.
+     */
+    void allocate(size_t size, buffer_usage_t usage = buffer_usage_t::static_draw);
+
+    /**
+     * @brief Binds the buffer, creates an immutable data storage for it and maps the whole storage persistently. The
+     * mapping stays valid until the buffer is destroyed. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferStorage.xhtml
+     *
+     * @param size Size of the data store in bytes.
+     * @param flags Storage flags, which must include buffer_access_t::map_persistent. The mapping uses the access bits.
+     * @return Start of the mapped storage.
+     * @throws std::runtime_error When extension_t::buffer_storage is missing or the storage cannot be mapped.
+     */
+    void *allocate_persistent(size_t size, buffer_access_t flags = buffer_access_t::map_write |
+                                                                    buffer_access_t::map_persistent |
+                                                                    buffer_access_t::map_coherent);
+
+    /**
+     * @brief Replaces part of the buffer object data storage, leaving the rest untouched. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferSubData.xhtml
+     *
+     * @param offset Offset in bytes where the replacement begins.
+     * @param data First element to be written.
+     * @param count Amount of elements to be written.
+     */
+    template <class type_t> void update(size_t offset, const type_t *data, size_t count) {
+        assert(offset + count * sizeof(type_t) <= m_size);
+        m_gl.buffer_sub_data(*this, offset, count * sizeof(type_t), data);
+    }
+
+    /**
+     * @brief Replaces part of the buffer object data storage, leaving the rest untouched. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferSubData.xhtml
+     *
+     * @param offset Offset in bytes where the replacement begins.
+     * @param data Data to be written.
+     */
+    template <class type_t> void update(size_t offset, const std::vector<type_t> &data) {
+        update(offset, data.data(), data.size());
     }
 
     /**
@@ -83,10 +142,17 @@ class buffer_t {
      */
     void set_target(buffer_target_t target);
 
+    /**
+     * @brief Gets the size of the data storage.
+     * @return Size in bytes, zero if the storage was not created yet.
+     */
+    [[nodiscard]] size_t get_size() const;
+
   private:
     gl_t &m_gl;
     id_buffer_t m_id;
     buffer_target_t m_target;
+    size_t m_size{};
 
     void destroy();
 };
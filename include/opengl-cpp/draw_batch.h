@@ -0,0 +1,97 @@
+#pragma once
+
+#include "buffer.h"
+#include "vertex_array.h"
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Layout of a non-indexed draw inside a draw indirect buffer. See
+ * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawArraysIndirect.xhtml
+ */
+struct draw_arrays_indirect_command_t {
+    uint32_t m_count;
+    uint32_t m_instance_count;
+    uint32_t m_first;
+    uint32_t m_base_instance;
+};
+
+/**
+ * @brief Layout of an indexed draw inside a draw indirect buffer. See
+ * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawElementsIndirect.xhtml
+ */
+struct draw_elements_indirect_command_t {
+    uint32_t m_count;
+    uint32_t m_instance_count;
+    uint32_t m_first_index;
+    int32_t m_base_vertex;
+    uint32_t m_base_instance;
+};
+
+/**
+ * @brief Collects draws over meshes sharing the buffers of a single vertex array, and submits all of them with one
+ * multi-draw-indirect call instead of one draw call each.
+ *
+ * The batch keeps a reference to its vertex array, which must stay alive and must not be moved while the batch is in
+ * use. Beware of vertex arrays stored in a std::vector, which moves them when it grows.
+ */
+class draw_batch_t {
+  public:
+    /**
+     * @brief Creates the draw indirect buffer.
+     *
+     * @param va Vertex array holding every mesh drawn by the batch, must outlive the batch. Draws are indexed if it has
+     * indices loaded.
+     * @throws std::runtime_error When extension_t::multi_draw_indirect is missing.
+     */
+    draw_batch_t(gl_t &gl, const vertex_array_t &va);
+
+    draw_batch_t(const draw_batch_t &) = delete;
+    draw_batch_t(draw_batch_t &&other) = delete;
+    draw_batch_t &operator=(const draw_batch_t &) = delete;
+    draw_batch_t &operator=(draw_batch_t &&other) = delete;
+    ~draw_batch_t() = default;
+
+    /**
+     * @brief Queues a draw.
+     *
+     * @param first First vertex, or first index if the vertex array is indexed.
+     * @param count Amount of vertices, or indices if the vertex array is indexed.
+     * @param base_vertex Value added to every index, so meshes can keep their own indices. Must be 0 if the vertex
+     * array is not indexed.
+     * @param instances Amount of instances.
+     * @param base_instance First instance, used to fetch per-instance attributes.
+     * @throws std::runtime_error When base_instance is not 0 and extension_t::base_instance is missing.
+     */
+    void add(size_t first, size_t count, int base_vertex = 0, size_t instances = 1, size_t base_instance = 0);
+
+    /**
+     * @brief Uploads the queued draws if they changed since the last submit, and issues them. The queue is kept until
+     * clear(), so static scenes can be submitted every frame without adding or uploading their draws again. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glMultiDrawElementsIndirect.xhtml
+     */
+    void submit();
+
+    /**
+     * @brief Drops the queued draws, keeping their memory for the next frame.
+     */
+    void clear();
+
+    [[nodiscard]] size_t size() const;
+    [[nodiscard]] bool is_indexed() const;
+
+  private:
+    gl_t &m_gl;
+    const vertex_array_t &m_va;
+    buffer_t m_buffer;
+    std::vector<draw_arrays_indirect_command_t> m_arrays;
+    std::vector<draw_elements_indirect_command_t> m_elements;
+    bool m_dirty{};
+};
+
+std::ostream &operator<<(std::ostream &os, const draw_batch_t &b);
+
+} // namespace opengl_cpp
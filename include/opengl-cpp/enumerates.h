@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <glad/glad.h>
 #include <ostream>
 
@@ -8,7 +9,69 @@ namespace opengl_cpp {
 enum class buffer_target_t {
     undefined = -1,
     simple_array = GL_ARRAY_BUFFER,
-    element_array = GL_ELEMENT_ARRAY_BUFFER
+    element_array = GL_ELEMENT_ARRAY_BUFFER,
+    uniform = GL_UNIFORM_BUFFER,
+    draw_indirect = GL_DRAW_INDIRECT_BUFFER,
+    pixel_unpack = GL_PIXEL_UNPACK_BUFFER
+};
+
+enum class buffer_usage_t {
+    undefined = -1,
+    static_draw = GL_STATIC_DRAW,
+    dynamic_draw = GL_DYNAMIC_DRAW,
+    stream_draw = GL_STREAM_DRAW
+};
+
+enum class index_type_t {
+    undefined = -1,
+    unsigned_short = GL_UNSIGNED_SHORT,
+    unsigned_int = GL_UNSIGNED_INT
+};
+
+enum class vertex_attrib_type_t {
+    signed_byte = GL_BYTE,
+    unsigned_byte = GL_UNSIGNED_BYTE,
+    signed_short = GL_SHORT,
+    unsigned_short = GL_UNSIGNED_SHORT,
+    signed_int = GL_INT,
+    unsigned_int = GL_UNSIGNED_INT,
+    half_float = GL_HALF_FLOAT,
+    single_float = GL_FLOAT,
+    int_2_10_10_10_rev = GL_INT_2_10_10_10_REV,
+    unsigned_int_2_10_10_10_rev = GL_UNSIGNED_INT_2_10_10_10_REV
+};
+
+enum class buffer_access_t : unsigned {
+    none = 0,
+    map_read = GL_MAP_READ_BIT,
+    map_write = GL_MAP_WRITE_BIT,
+    map_persistent = GL_MAP_PERSISTENT_BIT,
+    map_coherent = GL_MAP_COHERENT_BIT,
+    map_invalidate_range = GL_MAP_INVALIDATE_RANGE_BIT,
+    map_invalidate_buffer = GL_MAP_INVALIDATE_BUFFER_BIT,
+    map_flush_explicit = GL_MAP_FLUSH_EXPLICIT_BIT,
+    map_unsynchronized = GL_MAP_UNSYNCHRONIZED_BIT,
+    dynamic_storage = GL_DYNAMIC_STORAGE_BIT,
+    client_storage = GL_CLIENT_STORAGE_BIT
+};
+
+enum class sync_status_t {
+    already_signaled = GL_ALREADY_SIGNALED,
+    timeout_expired = GL_TIMEOUT_EXPIRED,
+    condition_satisfied = GL_CONDITION_SATISFIED,
+    wait_failed = GL_WAIT_FAILED
+};
+
+enum class extension_t {
+    base_instance,
+    buffer_storage,
+    get_program_binary,
+    multi_draw_indirect,
+    parallel_shader_compile,
+    texture_compression_bptc,
+    texture_compression_etc2,
+    texture_compression_s3tc,
+    texture_storage
 };
 
 enum class shader_type_t {
@@ -19,23 +82,72 @@ enum class shader_type_t {
 
 enum class shader_parameter_t {
     undefined = -1,
-    compile_status = GL_COMPILE_STATUS
+    compile_status = GL_COMPILE_STATUS,
+    completion_status = GL_COMPLETION_STATUS_KHR
 };
 
 enum class texture_format_t {
     undefined = -1,
+    red = GL_RED,
+    rg = GL_RG,
     rgb = GL_RGB,
     rgba = GL_RGBA
 };
 
+enum class texture_internal_format_t {
+    undefined = -1,
+    r8 = GL_R8,
+    rg8 = GL_RG8,
+    rgb8 = GL_RGB8,
+    rgba8 = GL_RGBA8,
+    srgb8 = GL_SRGB8,
+    srgb8_alpha8 = GL_SRGB8_ALPHA8,
+    r16f = GL_R16F,
+    rg16f = GL_RG16F,
+    rgba16f = GL_RGBA16F,
+    r32f = GL_R32F,
+    rg32f = GL_RG32F,
+    rgba32f = GL_RGBA32F,
+    depth24_stencil8 = GL_DEPTH24_STENCIL8,
+    bc1_rgb = GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+    bc1_rgba = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT,
+    bc3_rgba = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT,
+    bc4_r = GL_COMPRESSED_RED_RGTC1,
+    bc5_rg = GL_COMPRESSED_RG_RGTC2,
+    bc7_rgba = GL_COMPRESSED_RGBA_BPTC_UNORM_ARB,
+    bc7_srgb_alpha = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM_ARB,
+    etc2_rgb8 = GL_COMPRESSED_RGB8_ETC2,
+    etc2_srgb8 = GL_COMPRESSED_SRGB8_ETC2,
+    etc2_rgba8 = GL_COMPRESSED_RGBA8_ETC2_EAC,
+    etc2_srgb8_alpha8 = GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC
+};
+
+enum class pixel_type_t {
+    undefined = -1,
+    unsigned_byte = GL_UNSIGNED_BYTE,
+    half_float = GL_HALF_FLOAT,
+    single_float = GL_FLOAT
+};
+
 enum class program_parameter_t {
     undefined = -1,
-    link_status = GL_LINK_STATUS
+    link_status = GL_LINK_STATUS,
+    active_uniforms = GL_ACTIVE_UNIFORMS,
+    binary_retrievable_hint = GL_PROGRAM_BINARY_RETRIEVABLE_HINT,
+    completion_status = GL_COMPLETION_STATUS_KHR
+};
+
+enum class string_name_t {
+    vendor = GL_VENDOR,
+    renderer = GL_RENDERER,
+    version = GL_VERSION,
+    shading_language_version = GL_SHADING_LANGUAGE_VERSION
 };
 
 enum class texture_target_t {
     undefined = -1,
-    tex_2d = GL_TEXTURE_2D
+    tex_2d = GL_TEXTURE_2D,
+    tex_2d_array = GL_TEXTURE_2D_ARRAY
 };
 
 enum class texture_parameter_t {
@@ -73,6 +185,48 @@ enum class error_t {
     out_of_memory = GL_OUT_OF_MEMORY,
 };
 
+constexpr buffer_access_t operator|(buffer_access_t a, buffer_access_t b) {
+    return static_cast<buffer_access_t>(static_cast<unsigned>(a) | static_cast<unsigned>(b));
+}
+
+constexpr buffer_access_t operator&(buffer_access_t a, buffer_access_t b) {
+    return static_cast<buffer_access_t>(static_cast<unsigned>(a) & static_cast<unsigned>(b));
+}
+
+/**
+ * @brief Size in bytes of one pixel of format made of components of type, or 0 when either one is undefined.
+ */
+constexpr size_t get_pixel_size(texture_format_t format, pixel_type_t type) {
+    size_t components = 0;
+    switch (format) {
+    case texture_format_t::red:
+        components = 1;
+        break;
+    case texture_format_t::rg:
+        components = 2;
+        break;
+    case texture_format_t::rgb:
+        components = 3;
+        break;
+    case texture_format_t::rgba:
+        components = 4;
+        break;
+    default:
+        break;
+    }
+
+    switch (type) {
+    case pixel_type_t::unsigned_byte:
+        return components;
+    case pixel_type_t::half_float:
+        return components * 2;
+    case pixel_type_t::single_float:
+        return components * 4;
+    default:
+        return 0;
+    }
+}
+
 inline std::ostream &operator<<(std::ostream &os, opengl_cpp::buffer_target_t t) {
     return os << std::hex << "0x" << static_cast<int>(t);
 }
@@ -10,6 +10,7 @@ enum class identifier_type_t {
     program,
     texture,
     vertex_arrays,
+    query,
 };
 
 template <identifier_type_t id_type> class identifier_t {
@@ -61,6 +62,7 @@ using id_shader_t = identifier_t<identifier_type_t::shader>;
 using id_program_t = identifier_t<identifier_type_t::program>;
 using id_texture_t = identifier_t<identifier_type_t::texture>;
 using id_vertex_array_t = identifier_t<identifier_type_t::vertex_arrays>;
+using id_query_t = identifier_t<identifier_type_t::query>;
 
 template <identifier_type_t id_type>
 std::ostream &operator<<(std::ostream &os, const identifier_t<id_type> &id) {
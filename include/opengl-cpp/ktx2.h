@@ -0,0 +1,63 @@
+#pragma once
+
+#include "mapped_file.h"
+#include "texture.h"
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Reader of KTX2 texture containers. See https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+ *
+ * The file is memory-mapped and its header and level index are validated up front. Loading hands each mipmap level
+ * to OpenGL straight from the mapping, so the pixels are never copied or decoded on the CPU. Only 2D textures without
+ * supercompression are supported, in the block-compressed formats and in the uncompressed formats of
+ * texture_internal_format_t.
+ */
+class ktx2_file_t {
+  public:
+    /**
+     * @brief Maps and validates a KTX2 file.
+     * @param path File to be read.
+     * @throws std::runtime_error When the file cannot be mapped, is not a valid KTX2 file, or uses a feature or format
+     * that is not supported.
+     */
+    explicit ktx2_file_t(const std::filesystem::path &path);
+
+    /**
+     * @brief Creates a texture, allocates its storage and uploads every level of the file into it. The texture is left
+     * bound. When the file asks for its mipmaps to be generated, they are generated after the base level is uploaded.
+     * @param unit Texture unit of the texture.
+     * @return Loaded texture.
+     * @throws std::runtime_error When the context does not support the compressed format of the file.
+     */
+    [[nodiscard]] texture_t load(gl_t &gl, int unit) const;
+
+    /**
+     * @brief Gets the data of a mipmap level, pointing into the mapping.
+     * @param level Mipmap level, 0 being the base level.
+     * @return Level data.
+     */
+    [[nodiscard]] std::string_view get_level_data(size_t level) const;
+
+    [[nodiscard]] size_t get_width() const;
+    [[nodiscard]] size_t get_height() const;
+    [[nodiscard]] size_t get_levels() const;
+    [[nodiscard]] texture_internal_format_t get_format() const;
+
+  private:
+    mapped_file_t m_file;
+    size_t m_width{};
+    size_t m_height{};
+    bool m_generate_mipmap{};
+    texture_internal_format_t m_format{texture_internal_format_t::undefined};
+    std::vector<std::string_view> m_levels;
+};
+
+std::ostream &operator<<(std::ostream &os, const ktx2_file_t &f);
+
+} // namespace opengl_cpp
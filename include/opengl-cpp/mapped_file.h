@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped so its content is not copied.
+ */
+class mapped_file_t {
+  public:
+    /**
+     * @brief Maps a file.
+     * @param path File to be mapped.
+     * @throws std::runtime_error When the file cannot be opened or mapped.
+     */
+    explicit mapped_file_t(const std::filesystem::path &path);
+
+    /**
+     * @brief mapped file move-constructor.
+     *
+     * @param other mapped file to be emptied.
+     */
+    mapped_file_t(mapped_file_t &&other) noexcept;
+
+    mapped_file_t(const mapped_file_t &) = delete;
+    mapped_file_t &operator=(const mapped_file_t &) = delete;
+    mapped_file_t &operator=(mapped_file_t &&other) = delete;
+
+    /**
+     * @brief Unmaps the file.
+     */
+    ~mapped_file_t();
+
+    /**
+     * @brief Gets the file content.
+     * @return View valid for as long as the mapped file lives.
+     */
+    [[nodiscard]] std::string_view get_view() const;
+
+  private:
+    const char *m_data{};
+    size_t m_size{};
+};
+
+std::ostream &operator<<(std::ostream &os, const mapped_file_t &f);
+
+} // namespace opengl_cpp
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "mapped_file.h"
+#include "vertex_array.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Range of a mesh drawn on its own, counted in indices for indexed meshes and in vertices otherwise.
+ */
+struct mesh_range_t {
+    uint32_t m_first;
+    uint32_t m_count;
+};
+
+/**
+ * @brief Reader and writer of the opengl-cpp binary mesh container, made to be loaded without any parsing.
+ *
+ * A file starts with a fixed-size header holding the format version, the vertex layout, the index type, the bounds of
+ * the positions and the location of the payloads, followed by the table of sub-mesh ranges. The vertex and index
+ * payloads are stored exactly as they are uploaded, each one starting on a 64-byte boundary. The file is memory-mapped
+ * and validated up front, then loading hands both payloads to buffer_t straight from the mapping, so they are never
+ * copied or decoded on the CPU.
+ *
+ * Values are stored in the byte order of the machine that wrote the file, files from a machine of the other byte
+ * order are rejected as having a bad identifier.
+ */
+class mesh_file_t {
+  public:
+    static constexpr uint32_t version = 1;
+    static constexpr size_t payload_alignment = 64;
+    static constexpr size_t max_attributes = 16;
+
+    /**
+     * @brief Maps and validates a mesh file.
+     * @param path File to be read.
+     * @throws std::runtime_error When the file cannot be mapped, is not a valid mesh file, or has another version.
+     */
+    explicit mesh_file_t(const std::filesystem::path &path);
+
+    /**
+     * @brief Writes a mesh file. Indices are stored as 16-bit values whenever every vertex can be addressed with them,
+     * as vertex_array_t::load() would upload them.
+     * @param path File to be written.
+     * @param vertices Vertices of the mesh.
+     * @param indices Three indices into vertices per triangle, empty for a mesh drawn without indices.
+     * @param submeshes Ranges of the sub-meshes, empty for a single sub-mesh covering the whole mesh.
+     * @throws std::out_of_range When an index does not refer to a vertex.
+     * @throws std::runtime_error When the file cannot be written.
+     */
+    static void write(const std::filesystem::path &path, const std::vector<vertex_t> &vertices,
+                      const std::vector<unsigned> &indices, std::vector<mesh_range_t> submeshes = {});
+
+    /**
+     * @brief Creates a vertex array and uploads the vertex and index payloads into its buffers, with the attribute
+     * setup described by the file. The vertex array is left bound.
+     * @return Loaded vertex array.
+     */
+    [[nodiscard]] vertex_array_t load(gl_t &gl) const;
+
+    /**
+     * @brief Gets the vertex payload, pointing into the mapping.
+     * @return Vertex data.
+     */
+    [[nodiscard]] std::string_view get_vertex_data() const;
+
+    /**
+     * @brief Gets the index payload, pointing into the mapping.
+     * @return Index data, empty for a mesh drawn without indices.
+     */
+    [[nodiscard]] std::string_view get_index_data() const;
+
+    [[nodiscard]] size_t get_vertex_count() const;
+    [[nodiscard]] size_t get_index_count() const;
+    [[nodiscard]] index_type_t get_index_type() const;
+    [[nodiscard]] size_t get_stride() const;
+    [[nodiscard]] const std::vector<vertex_attribute_t> &get_attributes() const;
+    [[nodiscard]] const glm::vec3 &get_bounds_min() const;
+    [[nodiscard]] const glm::vec3 &get_bounds_max() const;
+    [[nodiscard]] const std::vector<mesh_range_t> &get_submeshes() const;
+
+  private:
+    mapped_file_t m_file;
+    size_t m_vertex_count{};
+    size_t m_index_count{};
+    index_type_t m_index_type{index_type_t::undefined};
+    size_t m_stride{};
+    std::vector<vertex_attribute_t> m_attributes;
+    glm::vec3 m_bounds_min{};
+    glm::vec3 m_bounds_max{};
+    std::vector<mesh_range_t> m_submeshes;
+    std::string_view m_vertex_data;
+    std::string_view m_index_data;
+};
+
+std::ostream &operator<<(std::ostream &os, const mesh_file_t &f);
+
+} // namespace opengl_cpp
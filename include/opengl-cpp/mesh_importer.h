@@ -0,0 +1,74 @@
+#pragma once
+
+#include "vertex_array.h"
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Indexed triangle mesh, ready to be handed to vertex_array_t::load().
+ */
+struct mesh_data_t {
+    std::vector<vertex_t> m_vertices;
+    std::vector<unsigned> m_indices;
+};
+
+/**
+ * @brief Imports triangle meshes from Wavefront OBJ and binary glTF 2.0 (.glb) files.
+ *
+ * Files are memory-mapped and parsed in place. Every stream is sized up front, so no allocation happens per vertex,
+ * and vertices are written directly into the vertex stream that is uploaded, without intermediate copies.
+ *
+ * OBJ files are split into chunks of whole lines parsed in parallel: a first pass counts the elements of each chunk,
+ * so the second one knows where to write them. Face corners are then merged into unique vertices through a hash table
+ * allocated once. Polygons are triangulated as fans, and only positions, texture coordinates, normals and faces are
+ * read.
+ *
+ * glTF files have the triangles of every primitive of every mesh appended together, with their POSITION, NORMAL and
+ * TEXCOORD_0 attributes interleaved in parallel. Node transforms, materials and external buffers are not supported.
+ */
+class mesh_importer_t {
+  public:
+    /**
+     * @brief Creates an importer.
+     * @param threads Maximum number of threads used per import. Zero uses one per hardware thread.
+     */
+    explicit mesh_importer_t(size_t threads = 0);
+
+    /**
+     * @brief Imports a file, whose format is picked from its extension, .obj or .glb.
+     * @param path File to be imported.
+     * @return Mesh.
+     * @throws std::runtime_error When the file cannot be mapped, its format is unknown, or it is malformed.
+     */
+    [[nodiscard]] mesh_data_t import(const std::filesystem::path &path) const;
+
+    /**
+     * @brief Imports the content of an OBJ file.
+     * @param text File content.
+     * @return Mesh.
+     * @throws std::runtime_error When a face refers to a missing element.
+     */
+    [[nodiscard]] mesh_data_t import_obj(std::string_view text) const;
+
+    /**
+     * @brief Imports the content of a glTF binary file.
+     * @param data File content.
+     * @return Mesh.
+     * @throws std::runtime_error When the file is malformed or uses unsupported features.
+     */
+    [[nodiscard]] mesh_data_t import_glb(std::string_view data) const;
+
+    [[nodiscard]] size_t get_threads() const;
+
+  private:
+    size_t m_threads;
+};
+
+std::ostream &operator<<(std::ostream &os, const mesh_importer_t &i);
+
+} // namespace opengl_cpp
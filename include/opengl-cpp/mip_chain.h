@@ -0,0 +1,90 @@
+#pragma once
+
+#include "texture.h"
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Filter used to reduce each mipmap level into the next one.
+ */
+enum class mip_filter_t {
+    box,   // Averages each 2x2 block, cheap and good enough for most content.
+    kaiser // Kaiser-windowed sinc over 8x8 texels, keeps the smaller levels sharper at the cost of more work.
+};
+
+/**
+ * @brief 8-bit image a mipmap chain is built from. Rows are aligned to 4 bytes, as for texture uploads.
+ */
+struct mip_image_t {
+    const unsigned char *m_pixels; // Base level pixels, not copied beyond the construction of the chain.
+    size_t m_width;
+    size_t m_height;
+    size_t m_channels; // 1 to 4, matching texture_format_t::red to texture_format_t::rgba.
+    bool m_srgb;       // Colour channels are sRGB-encoded and filtered in linear space, alpha is always linear.
+};
+
+/**
+ * @brief Mipmap level built on the CPU.
+ */
+struct mip_level_t {
+    size_t m_width;
+    size_t m_height;
+    size_t m_stride;                   // Bytes per row, aligned to 4.
+    std::vector<unsigned char> m_data; // Pixels, in the format of the base level.
+};
+
+/**
+ * @brief Mipmap chain built on the CPU, as an alternative to texture_t::generate_mipmap(). It does not need an OpenGL
+ * context, so chains can be built ahead of time, cached, and uploaded level by level later on.
+ *
+ * Levels are reduced one from the other in floating point, so rounding errors do not pile up down the chain, and the
+ * filter passes process whole rows and pixels with SIMD instructions where available.
+ */
+class mip_chain_t {
+  public:
+    /**
+     * @brief Builds the mipmap chain of an image.
+     * @param image Base level.
+     * @param filter Reduction filter.
+     * @param levels Number of levels, including the base one. Zero builds the complete chain, down to 1x1.
+     */
+    explicit mip_chain_t(const mip_image_t &image, mip_filter_t filter = mip_filter_t::box, size_t levels = 0);
+
+    /**
+     * @brief Builds the mipmap chains of many images in parallel, one image per thread at a time.
+     * @param images Base levels.
+     * @param filter Reduction filter.
+     * @param levels Number of levels of each chain, including the base one. Zero builds complete chains.
+     * @param threads Maximum number of threads. Zero uses one per hardware thread.
+     * @return Chains, in the order of the images.
+     * @throws std::exception The first exception thrown while building a chain, once every thread is done.
+     */
+    static std::vector<mip_chain_t> build(const std::vector<mip_image_t> &images,
+                                          mip_filter_t filter = mip_filter_t::box, size_t levels = 0,
+                                          size_t threads = 0);
+
+    /**
+     * @brief Uploads every level into a texture allocated with the size and internal format of the chain. Levels past
+     * the ones allocated in the texture are skipped. The texture must be bound.
+     * @param texture Destination texture.
+     */
+    void upload(texture_t &texture) const;
+
+    [[nodiscard]] const mip_level_t &get_level(size_t level) const;
+    [[nodiscard]] size_t get_levels() const;
+    [[nodiscard]] size_t get_channels() const;
+    [[nodiscard]] texture_format_t get_format() const;
+    [[nodiscard]] texture_internal_format_t get_internal_format() const;
+
+  private:
+    size_t m_channels;
+    bool m_srgb;
+    std::vector<mip_level_t> m_levels;
+};
+
+std::ostream &operator<<(std::ostream &os, const mip_chain_t &c);
+
+} // namespace opengl_cpp
@@ -1,14 +1,43 @@
 #pragma once
 
 #include "opengl-cpp/backend/gl.h"
+#include <deque>
 #include <functional>
+#include <mutex>
 #include <ostream>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace opengl_cpp {
 
 class shader_t;
 
+/**
+ * @brief Handle to a uniform variable of a linked program. It stays valid for as long as the program is not relinked,
+ * so it can be looked up once and reused on every draw.
+ */
+class uniform_t {
+  public:
+    explicit uniform_t(int location = -1) : m_location(location) {
+    }
+
+    /**
+     * @brief Gets the uniform location.
+     * @return Uniform location, -1 if the uniform is not active in the program.
+     */
+    [[nodiscard]] int get_location() const {
+        return m_location;
+    }
+
+    explicit operator bool() const {
+        return m_location >= 0;
+    }
+
+  private:
+    int m_location;
+};
+
 class program_t {
   public:
     /**
@@ -59,7 +88,7 @@ class program_t {
     void add_shader(shader_t shader);
 
     /**
-     * @brief Links the program with the previously defined shaders. See
+     * @brief Links the program with the previously defined shaders, then builds the table of active uniforms. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glLinkProgram.xhtml
      *
      * @throws GlError When the link fails.
@@ -67,13 +96,76 @@ class program_t {
     void link();
 
     /**
-     * @brief Gets the reference for a Uniform variable in OpenGL. See
+     * @brief Starts linking the program with the previously defined shaders, without waiting for the result, so the
+     * implementation can link several programs in parallel. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glLinkProgram.xhtml
+     *
+     * @throws GlError When the link cannot be started.
+     */
+    void submit_link();
+
+    /**
+     * @brief Checks, without blocking, if the link started by submit_link() is over. See
+     * https://registry.khronos.org/OpenGL/extensions/KHR/KHR_parallel_shader_compile.txt
+     *
+     * @return `true` if wait_link() would not block. Always `true` without extension_t::parallel_shader_compile.
+     */
+    [[nodiscard]] bool is_link_ready() const;
+
+    /**
+     * @brief Waits for the link started by submit_link(), checks its result then builds the table of active uniforms.
+     * When the link failed, the shaders are checked first, so a compile error is reported with the shader log.
+     *
+     * @throws GlError When a shader compilation or the link fails.
+     */
+    void wait_link();
+
+    /**
+     * @brief Asks the implementation to keep the linked binary retrievable. Must be called before link(). Requires
+     * extension_t::get_program_binary. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glProgramParameter.xhtml
+     */
+    void set_binary_retrievable();
+
+    /**
+     * @brief Gets the linked program binary, to be stored and loaded on a later run with load_binary(). Requires
+     * extension_t::get_program_binary. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetProgramBinary.xhtml
+     * @return Program binary.
+     */
+    [[nodiscard]] program_binary_t get_binary() const;
+
+    /**
+     * @brief Loads a previously linked binary instead of linking shaders, then builds the table of active uniforms.
+     * Requires extension_t::get_program_binary. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glProgramBinary.xhtml
+     * @param binary Binary returned by get_binary(), possibly on a previous run.
+     * @return `false` if the implementation rejected the binary, e.g. after a driver update. The program must then be
+     * linked from its shaders.
+     */
+    [[nodiscard]] bool load_binary(const program_binary_t &binary);
+
+    /**
+     * @brief Gets the reference for a Uniform variable in OpenGL. Names are looked up in the table built by link(),
+     * names missing from it (e.g. "arr[3]") are queried once then cached. Thread-safe, so a program can be shared by
+     * threads recording command lists. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetUniformLocation.xhtml
      * @param var_name Variable name.
      * @return The variable reference.
      */
     int get_uniform_location(const char *var_name) const;
 
+    /**
+     * @brief Gets a handle to a uniform variable, to be kept and passed to set_uniform() in hot paths.
+     * @param var_name Variable name.
+     * @return Uniform handle.
+     */
+    [[nodiscard]] uniform_t get_uniform(const char *var_name) const;
+
+    template <class... type_t> void set_uniform(uniform_t uniform, const type_t &...t) {
+        m_gl.set_uniform(uniform.get_location(), t...);
+    }
+
     template <class... type_t> void set_uniform(const char *var_name, const type_t &...t) {
         m_gl.set_uniform(get_uniform_location(var_name), t...);
     }
@@ -99,7 +191,12 @@ class program_t {
     gl_t &m_gl;
     std::vector<shader_t> m_shaders;
     id_program_t m_id;
+    mutable std::mutex m_uniform_mutex; // Guards the lazy insertions of get_uniform_location().
+    mutable std::deque<std::string> m_uniform_names;
+    mutable std::unordered_map<std::string_view, int> m_uniform_locations;
 
+    void add_uniform(std::string name, int location) const;
+    void build_uniform_table();
     void destroy();
 };
 
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "program.h"
+#include "shader.h"
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Opt-in on-disk cache of linked program binaries. Binaries are keyed by a hash of the shader types and
+ * sources, and of the vendor, renderer and version strings of the driver, so a driver update never loads a stale
+ * binary. When extension_t::get_program_binary is missing, programs are always compiled and linked.
+ */
+class program_cache_t {
+  public:
+    /**
+     * @brief Creates the cache, and its directory if needed.
+     * @param directory Where the binaries are stored.
+     */
+    program_cache_t(gl_t &gl, std::filesystem::path directory);
+
+    /**
+     * @brief Builds a program, loading its binary from the cache when possible. On a miss, or when the binary is
+     * rejected, the shaders are compiled and linked, and the resulting binary replaces the cached one.
+     * @param sources Shader stages of the program.
+     * @return Linked program.
+     * @throws std::runtime_error When compiling or linking fails.
+     */
+    program_t build(const std::vector<shader_source_t> &sources);
+
+    [[nodiscard]] const std::filesystem::path &get_directory() const;
+    [[nodiscard]] size_t get_hits() const;
+    [[nodiscard]] size_t get_misses() const;
+
+  private:
+    gl_t &m_gl;
+    std::filesystem::path m_directory;
+    bool m_enabled;
+    std::string m_driver;
+    size_t m_hits{};
+    size_t m_misses{};
+
+    [[nodiscard]] std::filesystem::path get_path(const std::vector<shader_source_t> &sources) const;
+    static std::optional<program_binary_t> read(const std::filesystem::path &path);
+    static void write(const std::filesystem::path &path, const program_binary_t &binary);
+};
+
+std::ostream &operator<<(std::ostream &os, const program_cache_t &c);
+
+} // namespace opengl_cpp
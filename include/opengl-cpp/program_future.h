@@ -0,0 +1,51 @@
+#pragma once
+
+#include "program.h"
+#include "shader.h"
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Program whose shaders are compiled and linked in the background. Creating many of them up front, then
+ * collecting them once ready, lets the implementation spread the work over its compiler threads (see
+ * gl_t::max_shader_compiler_threads) instead of compiling one shader at a time. Without
+ * extension_t::parallel_shader_compile, the work still happens but get() is where it blocks.
+ */
+class program_future_t {
+  public:
+    /**
+     * @brief Creates the shaders and the program, submits every compilation, then the link.
+     * @param sources Shader stages of the program.
+     * @throws GlError When a compilation or the link cannot be started.
+     */
+    program_future_t(gl_t &gl, const std::vector<shader_source_t> &sources);
+
+    /**
+     * @brief Checks, without blocking, if the program is compiled and linked.
+     * @return `true` if get() would not block.
+     */
+    [[nodiscard]] bool is_ready() const;
+
+    /**
+     * @brief Waits for the program to be linked, then hands it over. Can only be called once.
+     * @return Linked program.
+     * @throws GlError When a shader compilation or the link failed.
+     */
+    program_t get();
+
+    /**
+     * @brief Checks if get() can still be called.
+     * @return `true` until get() was called.
+     */
+    [[nodiscard]] bool is_valid() const;
+
+  private:
+    std::optional<program_t> m_program;
+};
+
+std::ostream &operator<<(std::ostream &os, const program_future_t &f);
+
+} // namespace opengl_cpp
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "vertex_array.h"
+#include "vertex_layout.h"
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief 16-byte vertex_t, half its size, for meshes limited by vertex fetch bandwidth.
+ */
+struct quantized_vertex_t {
+    std::array<uint16_t, 4> m_pos; // Position relative to the mesh bounds, normalized to [0, 1]. The fourth is padding.
+    std::array<int16_t, 2> m_nor;  // Octahedral-encoded normal, normalized to [-1, 1].
+    std::array<half_t, 2> m_tex;   // Texture coordinates.
+};
+
+/**
+ * @brief Layout of quantized_vertex_t, with the locations of vertex_layout. The shaders decode the attributes with
+ * quantized_vertex_glsl.
+ */
+inline constexpr auto quantized_vertex_layout = make_vertex_layout<quantized_vertex_t>(
+    make_vertex_attribute<decltype(quantized_vertex_t::m_pos)>(0, offsetof(quantized_vertex_t, m_pos), true),
+    make_vertex_attribute<decltype(quantized_vertex_t::m_tex)>(1, offsetof(quantized_vertex_t, m_tex)),
+    make_vertex_attribute<decltype(quantized_vertex_t::m_nor)>(2, offsetof(quantized_vertex_t, m_nor), true));
+
+/**
+ * @brief GLSL functions decoding quantized_vertex_t attributes, to be passed as one of the vertex shader sources,
+ * after the version directive. The bounds are those of the quantized mesh, usually set as uniforms.
+ */
+inline constexpr std::string_view quantized_vertex_glsl = R"(
+vec3 decode_position(vec4 position, vec3 bounds_min, vec3 bounds_extent) {
+    return bounds_min + position.xyz * bounds_extent;
+}
+
+vec3 decode_normal(vec2 normal) {
+    vec3 n = vec3(normal, 1.0 - abs(normal.x) - abs(normal.y));
+    float t = max(-n.z, 0.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+)";
+
+/**
+ * @brief Mesh of quantized vertices, with the bounds their positions are relative to.
+ */
+struct quantized_mesh_t {
+    std::vector<quantized_vertex_t> m_vertices;
+    glm::vec3 m_bounds_min;
+    glm::vec3 m_bounds_extent;
+};
+
+/**
+ * @brief Converts vertices to their quantized form. Positions keep 16 bits of precision across the mesh bounds,
+ * normals about 15 bits per axis, and texture coordinates 11 bits of mantissa.
+ * @param vertices Vertices to be converted. Normals are expected to be normalized.
+ * @return Quantized mesh.
+ */
+quantized_mesh_t quantize(const std::vector<vertex_t> &vertices);
+
+/**
+ * @brief Converts quantized vertices back, as the shaders would.
+ * @param mesh Quantized mesh.
+ * @return Vertices.
+ */
+std::vector<vertex_t> dequantize(const quantized_mesh_t &mesh);
+
+/**
+ * @brief Converts a float to half precision, rounding to nearest even.
+ * @param value Value to be converted.
+ * @return Half-precision value.
+ */
+half_t to_half(float value);
+
+/**
+ * @brief Converts a half-precision value to float, exactly.
+ * @param value Value to be converted.
+ * @return Single-precision value.
+ */
+float to_float(half_t value);
+
+} // namespace opengl_cpp
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Axis-aligned rectangle, in texels.
+ */
+struct rect_t {
+    size_t m_x;
+    size_t m_y;
+    size_t m_width;
+    size_t m_height;
+};
+
+bool operator==(const rect_t &a, const rect_t &b);
+
+/**
+ * @brief MaxRects rectangle packer. It keeps the maximal free rectangles left in the area and places each new
+ * rectangle in the free one it fits best by the shorter leftover side, which keeps the packing tight when rectangles
+ * are inserted one at a time. Rectangles are never rotated.
+ */
+class rect_packer_t {
+  public:
+    /**
+     * @brief Creates a packer with the whole area free.
+     * @param width Width of the area.
+     * @param height Height of the area.
+     */
+    rect_packer_t(size_t width, size_t height);
+
+    /**
+     * @brief Reserves a rectangle.
+     * @param width Width of the rectangle.
+     * @param height Height of the rectangle.
+     * @return Reserved rectangle, or nothing when there is no room left for it.
+     */
+    std::optional<rect_t> insert(size_t width, size_t height);
+
+    /**
+     * @brief Gives back a rectangle returned by insert(), so later insertions can reuse its area.
+     * @param rect Rectangle to be freed.
+     */
+    void remove(const rect_t &rect);
+
+    /**
+     * @brief Frees the whole area.
+     */
+    void clear();
+
+    [[nodiscard]] size_t get_width() const;
+    [[nodiscard]] size_t get_height() const;
+    [[nodiscard]] size_t get_used_area() const;
+    [[nodiscard]] const std::vector<rect_t> &get_free_rects() const;
+
+  private:
+    size_t m_width;
+    size_t m_height;
+    size_t m_used_area{};
+    std::vector<rect_t> m_free;
+
+    void split_free_rects(const rect_t &used);
+    void merge_free_rects();
+    void prune_free_rects();
+};
+
+std::ostream &operator<<(std::ostream &os, const rect_t &r);
+std::ostream &operator<<(std::ostream &os, const rect_packer_t &p);
+
+} // namespace opengl_cpp
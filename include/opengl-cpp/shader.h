@@ -4,9 +4,19 @@
 #include <filesystem>
 #include <ostream>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace opengl_cpp {
 
+/**
+ * @brief Source code of one shader stage of a program.
+ */
+struct shader_source_t {
+    shader_type_t m_type;
+    std::string m_source;
+};
+
 class shader_t {
   public:
     /**
@@ -20,7 +30,7 @@ class shader_t {
     explicit shader_t(gl_t &gl, shader_type_t type, const char *source = nullptr);
 
     /**
-     * @brief Construct a new shader object, reads its source from the filesystem then compiles it. See
+     * @brief Construct a new shader object, maps its source from the filesystem then compiles it. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCreateShader.xhtml
      *
      * @param type
@@ -28,6 +38,17 @@ class shader_t {
      */
     shader_t(gl_t &gl, shader_type_t type, const std::filesystem::path &shader_path);
 
+    /**
+     * @brief Construct a new shader object from several source chunks, passed as is to OpenGL which concatenates them,
+     * then compiles it. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glShaderSource.xhtml
+     *
+     * @param type Type of shader to be created.
+     * @param sources Source-code chunks, not necessarily null terminated.
+     * @throws GlError When the shader compilation fails.
+     */
+    shader_t(gl_t &gl, shader_type_t type, const std::vector<std::string_view> &sources);
+
     /**
      * @brief shader move-constructor.
      *
@@ -60,11 +81,47 @@ class shader_t {
      */
     [[nodiscard]] const id_shader_t &get_id() const;
 
+    /**
+     * @brief Sets the shader source and starts compiling it, without waiting for the result, so the implementation
+     * can compile several shaders in parallel. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCompileShader.xhtml
+     *
+     * @param source Source-code for the shader.
+     * @throws GlError When the compilation cannot be started.
+     */
+    void submit(const char *source);
+
+    /**
+     * @brief Sets the shader source chunks and starts compiling them, without waiting for the result. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glShaderSource.xhtml
+     *
+     * @param sources Source-code chunks, not necessarily null terminated.
+     * @throws GlError When the compilation cannot be started.
+     */
+    void submit(const std::vector<std::string_view> &sources);
+
+    /**
+     * @brief Checks, without blocking, if the compilation started by submit() is over. See
+     * https://registry.khronos.org/OpenGL/extensions/KHR/KHR_parallel_shader_compile.txt
+     *
+     * @return `true` if wait() would not block. Always `true` without extension_t::parallel_shader_compile.
+     */
+    [[nodiscard]] bool is_ready() const;
+
+    /**
+     * @brief Waits for the compilation started by submit() and checks its result. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetShader.xhtml
+     *
+     * @throws GlError When the shader compilation fails.
+     */
+    void wait();
+
   private:
     gl_t &m_gl;
     id_shader_t m_id;
 
     void compile(const char *source);
+    void start_compile();
     void destroy();
 };
 
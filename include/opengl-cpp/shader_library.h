@@ -0,0 +1,87 @@
+#pragma once
+
+#include "mapped_file.h"
+#include "shader.h"
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Loads shader sources from memory-mapped files, resolving `#include "file"` and `#include <file>` directives.
+ * Each file is mapped and parsed once, then the chunks between its directives are handed to the shaders as separate
+ * source strings pointing into the mapping, so nothing is copied or concatenated.
+ *
+ * Like with `#pragma once`, a file is only included once per shader, which also breaks include cycles. Files are looked
+ * up relative to the including file first, then in each include directory in order. Directives inside block comments
+ * are ignored.
+ *
+ * Files stay mapped until clear(), and they must not be modified while mapped: edits may show up in the cached
+ * sources, and truncating a file crashes the process when its chunks are read. Call clear() before editing them.
+ */
+class shader_library_t {
+  public:
+    /**
+     * @brief Creates an empty library.
+     * @param include_dirs Directories searched for included files.
+     */
+    explicit shader_library_t(std::vector<std::filesystem::path> include_dirs = {});
+
+    /**
+     * @brief Gets the source chunks of a shader, with its includes resolved. Results are cached.
+     * @param path Shader file.
+     * @return Chunks, valid for as long as the library lives and is not cleared.
+     * @throws std::runtime_error When a file or an included file cannot be found.
+     */
+    const std::vector<std::string_view> &get_sources(const std::filesystem::path &path);
+
+    /**
+     * @brief Creates a shader from a file, then compiles it.
+     * @param type Type of shader to be created.
+     * @param path Shader file.
+     * @return Compiled shader.
+     * @throws std::runtime_error When a file cannot be found or the shader compilation fails.
+     */
+    shader_t load(gl_t &gl, shader_type_t type, const std::filesystem::path &path);
+
+    /**
+     * @brief Unmaps every file and drops the resolved sources, e.g. before editing files.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the amount of files mapped so far.
+     * @return Mapped files.
+     */
+    [[nodiscard]] size_t get_file_count() const;
+
+  private:
+    struct segment_t {
+        std::string_view m_text;
+        std::string m_include; // Empty for text segments.
+    };
+
+    struct file_t {
+        mapped_file_t m_mapping;
+        std::filesystem::path m_directory;
+        std::vector<segment_t> m_segments;
+    };
+
+    std::vector<std::filesystem::path> m_include_dirs;
+    std::unordered_map<std::string, file_t> m_files;
+    std::unordered_map<std::string, std::vector<std::string_view>> m_sources;
+
+    const file_t &get_file(const std::filesystem::path &path);
+    std::filesystem::path find_include(const std::string &name, const std::filesystem::path &from) const;
+    void resolve(const file_t &file, const std::filesystem::path &path, std::vector<std::string_view> &sources,
+                 std::unordered_set<std::string> &included);
+};
+
+std::ostream &operator<<(std::ostream &os, const shader_library_t &l);
+
+} // namespace opengl_cpp
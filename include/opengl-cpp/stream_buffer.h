@@ -0,0 +1,92 @@
+#pragma once
+
+#include "buffer.h"
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Region of a stream buffer handed out for the current frame.
+ */
+struct stream_allocation_t {
+    void *m_data;    // Where the CPU writes, valid until the end of the frame.
+    size_t m_offset; // Offset of the region inside the buffer, to be passed to attribute pointers or draws.
+    size_t m_size;
+};
+
+class stream_buffer_t {
+  public:
+    /**
+     * @brief Number of frames the ring is split into, so the CPU can write one frame while the GPU reads the others.
+     */
+    static constexpr size_t frame_count = 3;
+
+    /**
+     * @brief Creates the buffer with immutable storage for frame_count frames and maps it persistently. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferStorage.xhtml
+     *
+     * @param target Buffer target.
+     * @param frame_size Amount of bytes available on each frame.
+     * @throws std::runtime_error When extension_t::buffer_storage is missing or the buffer cannot be mapped.
+     */
+    stream_buffer_t(gl_t &gl, buffer_target_t target, size_t frame_size);
+
+    /**
+     * @brief stream buffer move-constructor.
+     *
+     * @param other stream buffer to be emptied.
+     */
+    stream_buffer_t(stream_buffer_t &&other) noexcept;
+
+    stream_buffer_t(const stream_buffer_t &) = delete;
+    stream_buffer_t &operator=(const stream_buffer_t &) = delete;
+    stream_buffer_t &operator=(stream_buffer_t &&other) = delete;
+
+    /**
+     * @brief Destroys the pending fences and the buffer, which also releases the mapping.
+     */
+    ~stream_buffer_t();
+
+    /**
+     * @brief Binds the underlying buffer. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBindBuffer.xhtml
+     */
+    void bind();
+
+    /**
+     * @brief Sub-allocates a region of the current frame.
+     * @param size Amount of bytes.
+     * @param alignment Alignment of the region offset inside the buffer, e.g. GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT.
+     * @return Allocated region.
+     * @throws std::length_error When the current frame has no room left for the region.
+     */
+    stream_allocation_t allocate(size_t size, size_t alignment = 4);
+
+    /**
+     * @brief Ends the current frame. A fence is inserted after the commands reading it, then the ring moves on to the
+     * next frame, waiting for the GPU to be done with it if needed. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glFenceSync.xhtml
+     */
+    void end_frame();
+
+    [[nodiscard]] const buffer_t &get_buffer() const;
+    [[nodiscard]] size_t get_frame_size() const;
+    [[nodiscard]] size_t get_frame() const;
+
+  private:
+    gl_t &m_gl;
+    buffer_t m_buffer;
+    size_t m_frame_size;
+    std::byte *m_mapped{};
+    size_t m_frame{};
+    size_t m_offset{};
+    std::array<sync_t, frame_count> m_fences{};
+
+    void wait(size_t frame);
+};
+
+std::ostream &operator<<(std::ostream &os, const stream_buffer_t &b);
+
+} // namespace opengl_cpp
@@ -46,7 +46,32 @@ class texture_t {
     void bind();
 
     /**
-     * @brief Sets the texture image. See
+     * @brief Allocates immutable storage for every mipmap level at once, so the driver validates it only once and
+     * keeps the pixels in the given format. The texture must be bound. Its contents are then set with set_sub_image().
+     * See https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexStorage2D.xhtml
+     * @param width Width of the base level.
+     * @param height Height of the base level.
+     * @param format Sized internal format the texels are stored in.
+     * @param levels Number of mipmap levels, see get_full_levels() for a complete mipmap chain.
+     */
+    void allocate(size_t width, size_t height, texture_internal_format_t format, size_t levels = 1);
+
+    /**
+     * @brief Allocates immutable storage for every layer and mipmap level of a texture_target_t::tex_2d_array texture.
+     * Shaders sample it through a sampler2DArray, with the layer index as third texture coordinate, so images sharing
+     * a resolution can be picked per draw or per instance without switching textures. The texture must be bound. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexStorage3D.xhtml
+     * @param width Width of the base level.
+     * @param height Height of the base level.
+     * @param layers Number of layers.
+     * @param format Sized internal format the texels are stored in.
+     * @param levels Number of mipmap levels, see get_full_levels() for a complete mipmap chain.
+     */
+    void allocate_array(size_t width, size_t height, size_t layers, texture_internal_format_t format,
+                        size_t levels = 1);
+
+    /**
+     * @brief Sets the texture image. Not allowed once allocate() was called. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexImage2D.xhtml
      * @param width Specifies the width of the texture_coord image.
      * @param height Specifies the height of the texture_coord image.
@@ -56,7 +81,67 @@ class texture_t {
     void set_image(size_t width, size_t height, texture_format_t format, const unsigned char *data);
 
     /**
-     * @brief Generates the texture mipmap. See
+     * @brief Replaces a region of the texture image, which must have been allocated already. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexSubImage2D.xhtml
+     * @param level Mipmap level to be updated.
+     * @param x Horizontal offset of the region, in texels.
+     * @param y Vertical offset of the region, in texels.
+     * @param width Width of the region.
+     * @param height Height of the region.
+     * @param format Specifies the format of the pixel data.
+     * @param data Pointer to the region data in memory or, while a pixel unpack buffer is bound, offset into it.
+     * @param type Data type of the pixel data.
+     */
+    void set_sub_image(int level, size_t x, size_t y, size_t width, size_t height, texture_format_t format,
+                       const void *data, pixel_type_t type = pixel_type_t::unsigned_byte);
+
+    /**
+     * @brief Replaces a region of one layer of an array texture, which must have been allocated already. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexSubImage3D.xhtml
+     * @param layer Layer to be updated.
+     * @param level Mipmap level to be updated.
+     * @param x Horizontal offset of the region, in texels.
+     * @param y Vertical offset of the region, in texels.
+     * @param width Width of the region.
+     * @param height Height of the region.
+     * @param format Specifies the format of the pixel data.
+     * @param data Pointer to the region data in memory or, while a pixel unpack buffer is bound, offset into it.
+     * @param type Data type of the pixel data.
+     */
+    void set_layer_image(size_t layer, int level, size_t x, size_t y, size_t width, size_t height,
+                         texture_format_t format, const void *data, pixel_type_t type = pixel_type_t::unsigned_byte);
+
+    /**
+     * @brief Sets a mipmap level from block-compressed data, uploaded as is without being decoded on the CPU. Not
+     * allowed once allocate() was called. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCompressedTexImage2D.xhtml
+     * @param level Mipmap level to be set.
+     * @param width Width of the level.
+     * @param height Height of the level.
+     * @param format Compressed internal format of the data.
+     * @param size Size of the data in bytes, see get_compressed_size().
+     * @param data Pointer to the compressed data in memory or, while a pixel unpack buffer is bound, offset into it.
+     */
+    void set_compressed_image(int level, size_t width, size_t height, texture_internal_format_t format, size_t size,
+                              const void *data);
+
+    /**
+     * @brief Replaces a region of a texture allocated with a compressed internal format. Offsets and sizes are
+     * multiples of the 4x4 block size, except where the region reaches the edge of the level. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glCompressedTexSubImage2D.xhtml
+     * @param level Mipmap level to be updated.
+     * @param x Horizontal offset of the region, in texels.
+     * @param y Vertical offset of the region, in texels.
+     * @param width Width of the region.
+     * @param height Height of the region.
+     * @param size Size of the data in bytes, see get_compressed_size().
+     * @param data Pointer to the compressed data in memory or, while a pixel unpack buffer is bound, offset into it.
+     */
+    void set_compressed_sub_image(int level, size_t x, size_t y, size_t width, size_t height, size_t size,
+                                  const void *data);
+
+    /**
+     * @brief Generates the texture mipmap on the GPU, see mip_chain_t to build it on the CPU instead. See
      * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGenerateMipmap.xhtml
      */
     void generate_mipmap();
@@ -70,18 +155,52 @@ class texture_t {
     template <class type_t> void set_parameter(texture_parameter_t param, type_t value) {
         assert(m_id);
         assert(m_target != texture_target_t::undefined);
-        m_gl.set_parameter(param, value);
+        m_gl.set_parameter(*this, param, value);
     }
 
     [[nodiscard]] const id_texture_t &get_id() const;
     [[nodiscard]] texture_target_t get_target() const;
     [[nodiscard]] int get_unit() const;
+    [[nodiscard]] size_t get_width() const;
+    [[nodiscard]] size_t get_height() const;
+    [[nodiscard]] size_t get_levels() const;
+    [[nodiscard]] size_t get_layers() const;
+    [[nodiscard]] texture_internal_format_t get_internal_format() const;
+
+    /**
+     * @brief Computes the number of levels of a complete mipmap chain, down to 1x1.
+     * @param width Width of the base level.
+     * @param height Height of the base level.
+     * @return Number of mipmap levels.
+     */
+    static size_t get_full_levels(size_t width, size_t height);
+
+    /**
+     * @brief Checks whether an internal format is block-compressed.
+     * @param format Internal format.
+     * @return True for the BC and ETC2 formats.
+     */
+    static bool is_compressed(texture_internal_format_t format);
+
+    /**
+     * @brief Computes the size of an image in a block-compressed format, which is stored in 4x4 texel blocks.
+     * @param format Compressed internal format.
+     * @param width Width of the image.
+     * @param height Height of the image.
+     * @return Size of the image data in bytes.
+     */
+    static size_t get_compressed_size(texture_internal_format_t format, size_t width, size_t height);
 
   private:
     gl_t &m_gl;
     id_texture_t m_id;
     texture_target_t m_target{};
     int m_unit{-1};
+    size_t m_width{};
+    size_t m_height{};
+    size_t m_levels{};
+    size_t m_layers{};
+    texture_internal_format_t m_internal_format{texture_internal_format_t::undefined};
 
     void destroy();
 };
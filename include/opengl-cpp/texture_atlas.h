@@ -0,0 +1,102 @@
+#pragma once
+
+#include "rect_packer.h"
+#include "texture.h"
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Image packed into a texture atlas.
+ */
+struct atlas_entry_t {
+    size_t m_page;               // Index of the texture holding the image.
+    rect_t m_rect;               // Where the image is, in texels.
+    std::array<float, 4> m_uv{}; // Texture coordinates of the image corners: u0, v0, u1, v1.
+};
+
+/**
+ * @brief Packs many small images into a few large textures, so draws using different images can share the same
+ * texture binding and be batched.
+ *
+ * Each page is a texture with immutable storage and its own rectangle packer. Images go into the first page with room
+ * for them, and a new page is allocated when none has. Removed images free their area for later insertions.
+ */
+class texture_atlas_t {
+  public:
+    /**
+     * @brief Creates an empty atlas, pages are allocated on demand.
+     * @param unit Texture unit all the pages are bound to.
+     * @param page_size Width and height of each page.
+     * @param format Internal format of the pages.
+     * @param padding Texels around each image filled with copies of its edges, so filtering does not bleed the
+     * neighbours in.
+     */
+    texture_atlas_t(gl_t &gl, int unit, size_t page_size,
+                    texture_internal_format_t format = texture_internal_format_t::rgba8, size_t padding = 1);
+
+    /**
+     * @brief Packs and uploads an image. The page receiving it is left bound.
+     * @param width Width of the image.
+     * @param height Height of the image.
+     * @param format Format of the pixel data, whose rows are aligned to 4 bytes.
+     * @param data Pixel data.
+     * @param type Data type of the pixel data.
+     * @return Handle identifying the image in the atlas.
+     * @throws std::length_error When the image and its padding do not fit in a page.
+     */
+    size_t insert(size_t width, size_t height, texture_format_t format, const void *data,
+                  pixel_type_t type = pixel_type_t::unsigned_byte);
+
+    /**
+     * @brief Frees the area of an image, its texels and padding are left as they are until overwritten by the next
+     * image packed there.
+     * @param handle Handle returned by insert().
+     */
+    void remove(size_t handle);
+
+    /**
+     * @brief Gets where an image was packed.
+     * @param handle Handle returned by insert().
+     * @return Page and texture coordinates of the image.
+     */
+    [[nodiscard]] const atlas_entry_t &get_entry(size_t handle) const;
+
+    /**
+     * @brief Gets a page. The reference stays valid while the atlas is alive.
+     * @param page Page index, from an atlas entry.
+     * @return Page texture.
+     */
+    [[nodiscard]] texture_t &get_page(size_t page);
+
+    [[nodiscard]] size_t get_page_count() const;
+    [[nodiscard]] size_t get_page_size() const;
+    [[nodiscard]] size_t get_entry_count() const;
+
+  private:
+    struct page_t {
+        texture_t m_texture;
+        rect_packer_t m_packer;
+    };
+
+    gl_t &m_gl;
+    int m_unit;
+    size_t m_page_size;
+    texture_internal_format_t m_format;
+    size_t m_padding;
+    size_t m_next_handle{};
+    std::deque<page_t> m_pages; // Only appended to, which keeps references to the pages valid.
+    std::unordered_map<size_t, atlas_entry_t> m_entries;
+    std::vector<std::byte> m_padded; // Reused to extrude the edges of inserted images.
+
+    page_t &add_page();
+};
+
+std::ostream &operator<<(std::ostream &os, const texture_atlas_t &a);
+
+} // namespace opengl_cpp
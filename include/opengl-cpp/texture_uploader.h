@@ -0,0 +1,112 @@
+#pragma once
+
+#include "buffer.h"
+#include "texture.h"
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace opengl_cpp {
+
+/**
+ * @brief Staging slot handed out by a texture uploader.
+ */
+struct staging_region_t {
+    void *m_data;  // Where the pixels are written, from any thread, until the region is uploaded or discarded.
+    size_t m_slot; // Index of the slot inside the uploader.
+    size_t m_size;
+};
+
+/**
+ * @brief Streams texture updates through a pool of pixel unpack buffer slots, so the driver copies the pixels from
+ * buffer memory asynchronously instead of blocking the calling thread on client memory.
+ *
+ * The slots live in one persistently mapped buffer. Acquiring, writing and discarding slots is thread-safe and does not
+ * touch OpenGL, so loader threads can decode straight into them. Uploading and retiring must happen on the thread
+ * owning the context: each upload is followed by a fence, and the slot only becomes available again once retire()
+ * sees that fence signaled.
+ */
+class texture_uploader_t {
+  public:
+    static constexpr size_t default_slot_count = 4;
+
+    /**
+     * @brief Creates the staging buffer with immutable storage for all the slots and maps it persistently. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferStorage.xhtml
+     *
+     * @param slot_size Amount of bytes of each slot, e.g. the size of the largest image to be uploaded.
+     * @param slot_count Number of uploads that can be in flight at once.
+     * @throws std::runtime_error When extension_t::buffer_storage is missing or the buffer cannot be mapped.
+     */
+    texture_uploader_t(gl_t &gl, size_t slot_size, size_t slot_count = default_slot_count);
+
+    texture_uploader_t(const texture_uploader_t &) = delete;
+    texture_uploader_t(texture_uploader_t &&other) = delete;
+    texture_uploader_t &operator=(const texture_uploader_t &) = delete;
+    texture_uploader_t &operator=(texture_uploader_t &&other) = delete;
+
+    /**
+     * @brief Destroys the pending fences and the buffer, which also releases the mapping.
+     */
+    ~texture_uploader_t();
+
+    /**
+     * @brief Reserves a free slot to write pixels into. Thread-safe.
+     * @param size Amount of bytes to be written.
+     * @return Reserved region, or nothing when all the slots are being written or still read by the GPU.
+     * @throws std::length_error When size is larger than the slot size.
+     */
+    std::optional<staging_region_t> acquire(size_t size);
+
+    /**
+     * @brief Gives back a region without uploading it, e.g. when decoding failed. Thread-safe.
+     * @param region Region returned by acquire().
+     */
+    void discard(const staging_region_t &region);
+
+    /**
+     * @brief Updates a region of the texture with the pixels written into a staging region, then fences the slot.
+     * The texture must have been allocated already, and the writes into the region must be done. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glTexSubImage2D.xhtml
+     * @param texture Texture to be updated, it is left bound.
+     * @param region Region returned by acquire().
+     * @param level Mipmap level to be updated.
+     * @param x Horizontal offset of the updated area, in texels.
+     * @param y Vertical offset of the updated area, in texels.
+     * @param width Width of the updated area.
+     * @param height Height of the updated area.
+     * @param format Format of the pixels in the region.
+     * @param type Data type of the pixels in the region.
+     */
+    void upload(texture_t &texture, const staging_region_t &region, int level, size_t x, size_t y, size_t width,
+                size_t height, texture_format_t format, pixel_type_t type = pixel_type_t::unsigned_byte);
+
+    /**
+     * @brief Makes the slots the GPU is done reading available again, without waiting for the others. Meant to be
+     * called once per frame. See https://registry.khronos.org/OpenGL-Refpages/gl4/html/glClientWaitSync.xhtml
+     * @throws std::runtime_error When waiting on a fence fails.
+     */
+    void retire();
+
+    [[nodiscard]] const buffer_t &get_buffer() const;
+    [[nodiscard]] size_t get_slot_size() const;
+    [[nodiscard]] size_t get_slot_count() const;
+    [[nodiscard]] size_t get_free_count() const;
+
+  private:
+    enum class slot_state_t { free, writing, in_flight };
+
+    gl_t &m_gl;
+    buffer_t m_buffer;
+    size_t m_slot_size;
+    std::byte *m_mapped{};
+    mutable std::mutex m_mutex;
+    std::vector<slot_state_t> m_states;
+    std::vector<sync_t> m_fences;
+};
+
+std::ostream &operator<<(std::ostream &os, const texture_uploader_t &u);
+
+} // namespace opengl_cpp
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "buffer.h"
+#include "vertex_layout.h"
+#include <cassert>
+#include <cstddef>
 #include <ostream>
 #include <vector>
 
@@ -12,6 +15,14 @@ struct vertex_t {
     glm::vec3 m_nor;
 };
 
+/**
+ * @brief Layout of vertex_t: position, texture coordinates and normal at locations 0, 1 and 2.
+ */
+inline constexpr auto vertex_layout =
+    make_vertex_layout<vertex_t>(make_vertex_attribute<glm::vec3>(0, offsetof(vertex_t, m_pos)),
+                                 make_vertex_attribute<glm::vec2>(1, offsetof(vertex_t, m_tex)),
+                                 make_vertex_attribute<glm::vec3>(2, offsetof(vertex_t, m_nor)));
+
 class vertex_array_t {
   public:
     /**
@@ -77,11 +88,118 @@ class vertex_array_t {
      */
     void load(const std::vector<vertex_t> &vertices);
 
+    /**
+     * @brief Loads vertices of any struct, with the attribute setup described by its layout, so each mesh can use the
+     * narrowest component types it needs. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glVertexAttribPointer.xhtml
+     *
+     * @param vertices Vertices to be stored.
+     * @param layout Layout of vertex_type_t, see make_vertex_layout().
+     */
+    template <class vertex_type_t, size_t count>
+    void load(const std::vector<vertex_type_t> &vertices, const vertex_layout_t<count> &layout) {
+        assert(layout.m_stride == sizeof(vertex_type_t));
+        load(vertices.data(), vertices.size(), layout.m_attributes.data(), count, layout.m_stride);
+    }
+
+    /**
+     * @brief Loads vertices already laid out in memory, such as a mapped mesh file, see the overloads above.
+     *
+     * @param vertices First vertex, of stride bytes.
+     * @param vertex_count Amount of vertices.
+     * @param attributes First attribute of the vertices.
+     * @param attribute_count Amount of attributes.
+     * @param stride Size of each vertex in bytes.
+     */
+    void load(const void *vertices, size_t vertex_count, const vertex_attribute_t *attributes, size_t attribute_count,
+              size_t stride);
+
+    /**
+     * @brief Loads an indexed mesh. Indices are stored as 16-bit values whenever every vertex can be addressed with
+     * them, halving the element array buffer size, and as 32-bit values otherwise. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferData.xhtml
+     *
+     * @param vertices Vertices shared by the triangles.
+     * @param indices Three indices into vertices per triangle.
+     */
+    void load(const std::vector<vertex_t> &vertices, const std::vector<unsigned> &indices);
+
+    /**
+     * @brief Loads an indexed mesh of vertices of any struct, see the overloads above.
+     *
+     * @param vertices Vertices shared by the triangles.
+     * @param indices Three indices into vertices per triangle.
+     * @param layout Layout of vertex_type_t, see make_vertex_layout().
+     */
+    template <class vertex_type_t, size_t count>
+    void load(const std::vector<vertex_type_t> &vertices, const std::vector<unsigned> &indices,
+              const vertex_layout_t<count> &layout) {
+        load(vertices, layout);
+        load_indices(indices);
+    }
+
+    /**
+     * @brief Loads indices already narrowed to their final type, into the element array buffer of the vertices loaded
+     * last. See https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferData.xhtml
+     *
+     * @param indices First index.
+     * @param index_count Amount of indices.
+     * @param type Type of the indices.
+     */
+    void load_indices(const void *indices, size_t index_count, index_type_t type);
+
+    /**
+     * @brief Loads a per-instance attribute stream into its own buffer. Each element of instances is split into
+     * consecutive float attributes starting at first_location, e.g. {4, 4, 4, 4, 4} for a glm::mat4 model matrix
+     * followed by a glm::vec4 color. Every call replaces the data and the attribute layout, so it can be refreshed
+     * every frame. Draws are issued for instances.size() * divisor instances. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glVertexAttribDivisor.xhtml
+     *
+     * @param first_location Location of the first attribute, the following ones take the next locations.
+     * @param instances Per-instance data, made of floats.
+     * @param components Amount of floats, from 1 to 4, of each attribute.
+     * @param divisor Amount of instances sharing each element.
+     */
+    template <class instance_t>
+    void load_instances(unsigned first_location, const std::vector<instance_t> &instances,
+                        const std::vector<size_t> &components, unsigned divisor = 1) {
+        load_instances(first_location, instances.data(), instances.size(), sizeof(instance_t), components, divisor);
+    }
+
+    /**
+     * @brief Draws the loaded triangles, through the element array buffer if indices were loaded, once per loaded
+     * instance if instances were loaded. See
+     * https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawElementsInstanced.xhtml
+     */
+    void draw() const;
+
+    /**
+     * @brief Draws a range of the loaded triangles, e.g. a sub-mesh, counted in indices if indices were loaded and in
+     * vertices otherwise. See https://registry.khronos.org/OpenGL-Refpages/gl4/html/glDrawElements.xhtml
+     *
+     * @param first First index, or vertex, of the range.
+     * @param count Amount of indices, or vertices, of the range.
+     */
+    void draw(size_t first, size_t count) const;
+
+    [[nodiscard]] size_t get_vertex_count() const;
+    [[nodiscard]] size_t get_index_count() const;
+    [[nodiscard]] index_type_t get_index_type() const;
+    [[nodiscard]] size_t get_instance_count() const;
+
   private:
     gl_t &m_gl;
     id_vertex_array_t m_id;
     std::vector<buffer_t> m_buffers;
-
+    size_t m_vertex_count{};
+    size_t m_index_count{};
+    index_type_t m_index_type{index_type_t::undefined};
+    size_t m_instance_count{};
+
+    void set_layout(const vertex_attribute_t *attributes, size_t count, size_t stride);
+    void load_indices(const std::vector<unsigned> &indices);
+    void load_instances(unsigned first_location, const void *data, size_t count, size_t stride,
+                        const std::vector<size_t> &components, unsigned divisor);
     void destroy();
 };
 
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "enumerates.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace opengl_cpp {
+
+/**
+ * @brief IEEE 754 half-precision float, as stored in vertex buffers.
+ */
+struct half_t {
+    uint16_t m_bits;
+};
+
+/**
+ * @brief Four signed components packed in 32 bits: x, y and z take 10 bits each from the lowest bits, w the top 2.
+ */
+struct packed_2_10_10_10_t {
+    uint32_t m_bits;
+};
+
+/**
+ * @brief Four unsigned components packed in 32 bits, laid out like packed_2_10_10_10_t.
+ */
+struct unsigned_packed_2_10_10_10_t {
+    uint32_t m_bits;
+};
+
+/**
+ * @brief Maps a C++ component type to its OpenGL vertex attribute type.
+ */
+template <class type_t> struct vertex_component_traits_t;
+
+template <vertex_attrib_type_t attrib_type, size_t component_count = 1> struct vertex_component_info_t {
+    static constexpr vertex_attrib_type_t type = attrib_type;
+    static constexpr size_t components = component_count;
+};
+
+template <> struct vertex_component_traits_t<int8_t> : vertex_component_info_t<vertex_attrib_type_t::signed_byte> {};
+template <> struct vertex_component_traits_t<uint8_t> : vertex_component_info_t<vertex_attrib_type_t::unsigned_byte> {};
+template <> struct vertex_component_traits_t<int16_t> : vertex_component_info_t<vertex_attrib_type_t::signed_short> {};
+template <>
+struct vertex_component_traits_t<uint16_t> : vertex_component_info_t<vertex_attrib_type_t::unsigned_short> {};
+template <> struct vertex_component_traits_t<int32_t> : vertex_component_info_t<vertex_attrib_type_t::signed_int> {};
+template <> struct vertex_component_traits_t<uint32_t> : vertex_component_info_t<vertex_attrib_type_t::unsigned_int> {};
+template <> struct vertex_component_traits_t<half_t> : vertex_component_info_t<vertex_attrib_type_t::half_float> {};
+template <> struct vertex_component_traits_t<float> : vertex_component_info_t<vertex_attrib_type_t::single_float> {};
+template <>
+struct vertex_component_traits_t<packed_2_10_10_10_t>
+    : vertex_component_info_t<vertex_attrib_type_t::int_2_10_10_10_rev, 4> {};
+template <>
+struct vertex_component_traits_t<unsigned_packed_2_10_10_10_t>
+    : vertex_component_info_t<vertex_attrib_type_t::unsigned_int_2_10_10_10_rev, 4> {};
+
+/**
+ * @brief Maps the C++ type of a vertex member to its attribute component type and count. Vector types exposing a
+ * value_type, like the glm vectors and std::array, hold as many components as value_type fits in them.
+ */
+template <class type_t, class = void> struct vertex_attribute_traits_t {
+    using component_t = type_t;
+    static constexpr size_t components = vertex_component_traits_t<type_t>::components;
+};
+
+template <class type_t> struct vertex_attribute_traits_t<type_t, std::void_t<typename type_t::value_type>> {
+    using component_t = typename type_t::value_type;
+    static constexpr size_t components = sizeof(type_t) / sizeof(component_t);
+};
+
+/**
+ * @brief Attribute of a vertex layout, what glVertexAttribPointer() is called with.
+ */
+struct vertex_attribute_t {
+    unsigned m_location;
+    size_t m_components;
+    vertex_attrib_type_t m_type;
+    bool m_normalized;
+    unsigned m_offset;
+};
+
+/**
+ * @brief Layout of a vertex struct: its size and the attributes its members are bound to.
+ */
+template <size_t count> struct vertex_layout_t {
+    size_t m_stride;
+    std::array<vertex_attribute_t, count> m_attributes;
+};
+
+/**
+ * @brief Describes a vertex struct member as an attribute, with the component type and count deduced from its type.
+ * @param location Attribute location in the shaders.
+ * @param offset Offset of the member in the vertex struct, from offsetof().
+ * @param normalized Whether integer components are mapped to [0, 1], or [-1, 1] when signed, instead of converted as
+ * they are.
+ * @return Attribute.
+ */
+template <class member_t>
+constexpr vertex_attribute_t make_vertex_attribute(unsigned location, size_t offset, bool normalized = false) {
+    using traits_t = vertex_attribute_traits_t<member_t>;
+    using component_traits_t = vertex_component_traits_t<typename traits_t::component_t>;
+    static_assert(traits_t::components >= 1 && traits_t::components <= 4, "attributes have 1 to 4 components");
+    return {location, traits_t::components, component_traits_t::type, normalized, static_cast<unsigned>(offset)};
+}
+
+/**
+ * @brief Describes the layout of a vertex struct, e.g.
+ *
+ *     constexpr auto layout = make_vertex_layout<vertex_t>(
+ *         make_vertex_attribute<glm::vec3>(0, offsetof(vertex_t, m_pos)),
+ *         make_vertex_attribute<std::array<uint16_t, 2>>(1, offsetof(vertex_t, m_tex), true));
+ *
+ * @param attributes Attributes of the members.
+ * @return Layout, usable at compile time.
+ */
+template <class vertex_type_t, class... attribute_ts>
+constexpr vertex_layout_t<sizeof...(attribute_ts)> make_vertex_layout(attribute_ts... attributes) {
+    return {sizeof(vertex_type_t), {attributes...}};
+}
+
+} // namespace opengl_cpp
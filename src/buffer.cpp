@@ -1,6 +1,7 @@
 #include "buffer.h"
 
 #include <cassert>
+#include <stdexcept>
 
 namespace opengl_cpp {
 
@@ -23,13 +24,14 @@ buffer_t::buffer_t(gl_t &gl, id_buffer_t id, buffer_target_t target) : m_gl(gl),
     }
 }
 
-buffer_t::buffer_t(buffer_t &&other) noexcept : m_gl(other.m_gl), m_target(other.m_target) {
+buffer_t::buffer_t(buffer_t &&other) noexcept : m_gl(other.m_gl), m_target(other.m_target), m_size(other.m_size) {
     if (m_id) {
         destroy();
     }
 
     m_id = std::move(other.m_id);
     other.m_target = buffer_target_t::undefined;
+    other.m_size = 0;
 }
 
 buffer_t::~buffer_t() {
@@ -47,6 +49,8 @@ buffer_t &buffer_t::operator=(buffer_t &&other) noexcept {
 
     m_target = other.m_target;
     other.m_target = buffer_target_t::undefined;
+    m_size = other.m_size;
+    other.m_size = 0;
     return *this;
 }
 
@@ -56,6 +60,39 @@ void buffer_t::bind() {
     m_gl.bind(*this);
 }
 
+void buffer_t::load(const void *data, size_t size, buffer_usage_t usage) {
+    m_gl.buffer_data(*this, size, data, usage);
+    m_size = size;
+}
+
+void buffer_t::allocate(size_t size, buffer_usage_t usage) {
+    assert(m_id);
+    m_gl.buffer_data(*this, size, nullptr, usage);
+    m_size = size;
+}
+
+void *buffer_t::allocate_persistent(size_t size, buffer_access_t flags) {
+    assert(m_id);
+    assert((flags & buffer_access_t::map_persistent) == buffer_access_t::map_persistent);
+
+    if (!m_gl.has_extension(extension_t::buffer_storage)) {
+        throw std::runtime_error("persistent buffer mapping requires GL_ARB_buffer_storage");
+    }
+
+    bind();
+    m_gl.buffer_storage(*this, size, nullptr, flags);
+    m_size = size;
+
+    // The storage-only bits, such as dynamic_storage and client_storage, are invalid for glMapBufferRange().
+    constexpr auto map_flags = buffer_access_t::map_read | buffer_access_t::map_write | buffer_access_t::map_persistent |
+                               buffer_access_t::map_coherent;
+    auto *mapped = m_gl.map_buffer_range(*this, 0, size, flags & map_flags);
+    if (mapped == nullptr) {
+        throw std::runtime_error("failed to map the buffer storage persistently");
+    }
+    return mapped;
+}
+
 const id_buffer_t &buffer_t::get_id() const {
     return m_id;
 }
@@ -68,10 +105,15 @@ void buffer_t::set_target(buffer_target_t target) {
     m_target = target;
 }
 
+size_t buffer_t::get_size() const {
+    return m_size;
+}
+
 void buffer_t::destroy() {
     assert(m_id);
     m_gl.destroy(1, &m_id);
     m_id = 0;
+    m_size = 0;
 }
 
 std::ostream &operator<<(std::ostream &os, const buffer_t &b) {
@@ -0,0 +1,73 @@
+#include "draw_batch.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace opengl_cpp {
+
+draw_batch_t::draw_batch_t(gl_t &gl, const vertex_array_t &va)
+    : m_gl(gl), m_va(va), m_buffer(gl, 0, buffer_target_t::draw_indirect) {
+
+    if (!m_gl.has_extension(extension_t::multi_draw_indirect)) {
+        throw std::runtime_error("draw_batch_t requires GL_ARB_multi_draw_indirect");
+    }
+}
+
+void draw_batch_t::add(size_t first, size_t count, int base_vertex, size_t instances, size_t base_instance) {
+    if (base_instance != 0 && !m_gl.has_extension(extension_t::base_instance)) {
+        throw std::runtime_error("draw_batch_t requires GL_ARB_base_instance for a non-zero base instance");
+    }
+
+    if (is_indexed()) {
+        m_elements.push_back({static_cast<uint32_t>(count), static_cast<uint32_t>(instances),
+                              static_cast<uint32_t>(first), base_vertex, static_cast<uint32_t>(base_instance)});
+    } else {
+        assert(base_vertex == 0);
+        m_arrays.push_back({static_cast<uint32_t>(count), static_cast<uint32_t>(instances),
+                            static_cast<uint32_t>(first), static_cast<uint32_t>(base_instance)});
+    }
+    m_dirty = true;
+}
+
+void draw_batch_t::submit() {
+    if (size() == 0) {
+        return;
+    }
+
+    m_va.bind();
+    m_buffer.bind();
+    if (m_dirty) {
+        if (is_indexed()) {
+            m_buffer.load(m_elements, buffer_usage_t::dynamic_draw);
+        } else {
+            m_buffer.load(m_arrays, buffer_usage_t::dynamic_draw);
+        }
+        m_dirty = false;
+    }
+
+    if (is_indexed()) {
+        m_gl.multi_draw_elements_indirect(m_va.get_index_type(), 0, m_elements.size(), 0);
+    } else {
+        m_gl.multi_draw_arrays_indirect(0, m_arrays.size(), 0);
+    }
+}
+
+void draw_batch_t::clear() {
+    m_arrays.clear();
+    m_elements.clear();
+    m_dirty = true;
+}
+
+size_t draw_batch_t::size() const {
+    return m_arrays.size() + m_elements.size();
+}
+
+bool draw_batch_t::is_indexed() const {
+    return m_va.get_index_type() != index_type_t::undefined;
+}
+
+std::ostream &operator<<(std::ostream &os, const draw_batch_t &b) {
+    return os << "draw_batch(" << &b << ") size=" << b.size() << ", indexed=" << b.is_indexed();
+}
+
+} // namespace opengl_cpp
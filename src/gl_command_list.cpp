@@ -0,0 +1,976 @@
+#include "opengl-cpp/backend/gl_command_list.h"
+
+#include "buffer.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+using opengl_cpp::buffer_t;
+using opengl_cpp::graphics_feature_t;
+using opengl_cpp::polygon_mode_t;
+using opengl_cpp::program_t;
+using opengl_cpp::shader_t;
+using opengl_cpp::texture_format_t;
+using opengl_cpp::texture_parameter_t;
+using opengl_cpp::texture_parameter_values_t;
+
+enum class opcode_t : uint32_t {
+    activate,
+    attach_shader,
+    bind_buffer,
+    bind_texture,
+    bind_vertex_array,
+    buffer_data,
+    buffer_sub_data,
+    buffer_storage,
+    clear,
+    set_clear_color,
+    destroy_buffers,
+    destroy_program,
+    destroy_shader,
+    destroy_sync,
+    destroy_textures,
+    destroy_vertex_arrays,
+    destroy_queries,
+    disable,
+    draw_arrays,
+    draw_arrays_instanced,
+    draw_elements,
+    draw_elements_instanced,
+    multi_draw_arrays_indirect,
+    multi_draw_elements_indirect,
+    enable,
+    enable_vertex_attrib_array,
+    generate_mipmap,
+    max_shader_compiler_threads,
+    polygon_mode,
+    query_counter,
+    set_sources,
+    set_image,
+    set_parameter,
+    set_sub_image,
+    set_sub_image_3d,
+    texture_storage,
+    texture_storage_3d,
+    compressed_image,
+    compressed_sub_image,
+    set_program_parameter,
+    set_uniform_float,
+    set_uniform_int,
+    set_uniform_array3,
+    set_uniform_array4,
+    set_uniform_vec3,
+    set_uniform_mat4,
+    unbind_buffer,
+    use,
+    vertex_attrib_pointer,
+    vertex_attrib_pointer_typed,
+    vertex_attrib_divisor,
+    set_viewport,
+};
+
+struct command_header_t {
+    opcode_t opcode;
+    uint32_t size;
+};
+
+struct arena_range_t {
+    size_t offset;
+    size_t size;
+};
+
+template <class object_t> struct object_command_t {
+    const object_t *object;
+};
+
+template <class value_t> struct value_command_t {
+    value_t value;
+};
+
+template <class value_t> struct uniform_command_t {
+    int location;
+    value_t value;
+};
+
+struct attach_shader_command_t {
+    const program_t *program;
+    const shader_t *shader;
+};
+
+struct buffer_data_command_t {
+    const buffer_t *buffer;
+    size_t size;
+    bool has_data;
+    arena_range_t data;
+    opengl_cpp::buffer_usage_t usage;
+};
+
+struct buffer_sub_data_command_t {
+    const buffer_t *buffer;
+    size_t offset;
+    arena_range_t data;
+};
+
+struct buffer_storage_command_t {
+    const buffer_t *buffer;
+    size_t size;
+    bool has_data;
+    arena_range_t data;
+    opengl_cpp::buffer_access_t flags;
+};
+
+struct draw_arrays_command_t {
+    int first;
+    size_t count;
+};
+
+struct draw_arrays_instanced_command_t {
+    int first;
+    size_t count;
+    size_t instances;
+};
+
+struct draw_elements_command_t {
+    size_t count;
+    opengl_cpp::index_type_t type;
+    size_t offset;
+};
+
+struct draw_elements_instanced_command_t {
+    size_t count;
+    opengl_cpp::index_type_t type;
+    size_t offset;
+    size_t instances;
+};
+
+struct multi_draw_indirect_command_t {
+    opengl_cpp::index_type_t type;
+    size_t offset;
+    size_t draw_count;
+    size_t stride;
+};
+
+struct set_sources_command_t {
+    const shader_t *shader;
+    size_t num_sources;
+    arena_range_t sources;
+};
+
+enum class pixel_source_t : uint8_t {
+    none,
+    arena, // Copied client memory.
+    buffer // Offset into the buffer bound to GL_PIXEL_UNPACK_BUFFER when recorded.
+};
+
+struct pixels_t {
+    pixel_source_t source;
+    arena_range_t data;
+};
+
+struct set_image_command_t {
+    const opengl_cpp::texture_t *texture;
+    size_t width;
+    size_t height;
+    texture_format_t format;
+    pixels_t pixels;
+};
+
+struct set_sub_image_command_t {
+    const opengl_cpp::texture_t *texture;
+    int level;
+    size_t x;
+    size_t y;
+    size_t width;
+    size_t height;
+    texture_format_t format;
+    opengl_cpp::pixel_type_t type;
+    pixels_t pixels;
+};
+
+struct set_sub_image_3d_command_t {
+    const opengl_cpp::texture_t *texture;
+    int level;
+    size_t x;
+    size_t y;
+    size_t z;
+    size_t width;
+    size_t height;
+    size_t depth;
+    texture_format_t format;
+    opengl_cpp::pixel_type_t type;
+    pixels_t pixels;
+};
+
+struct texture_storage_command_t {
+    const opengl_cpp::texture_t *texture;
+    size_t levels;
+    opengl_cpp::texture_internal_format_t format;
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+
+struct compressed_image_command_t {
+    const opengl_cpp::texture_t *texture;
+    int level;
+    size_t x;
+    size_t y;
+    size_t width;
+    size_t height;
+    opengl_cpp::texture_internal_format_t format;
+    size_t size;
+    pixels_t pixels;
+};
+
+struct set_parameter_command_t {
+    const opengl_cpp::texture_t *texture;
+    texture_parameter_t name;
+    texture_parameter_values_t value;
+};
+
+struct set_program_parameter_command_t {
+    const program_t *program;
+    opengl_cpp::program_parameter_t param;
+    int value;
+};
+
+struct vertex_attrib_pointer_command_t {
+    unsigned index;
+    size_t size;
+    size_t stride;
+    unsigned offset;
+};
+
+struct vertex_attrib_pointer_typed_command_t {
+    unsigned index;
+    size_t size;
+    opengl_cpp::vertex_attrib_type_t type;
+    bool normalized;
+    size_t stride;
+    unsigned offset;
+};
+
+struct vertex_attrib_divisor_command_t {
+    unsigned index;
+    unsigned divisor;
+};
+
+struct viewport_command_t {
+    size_t width;
+    size_t height;
+};
+
+void record(std::vector<std::byte> &commands, opcode_t opcode) {
+    const command_header_t header{opcode, 0};
+    const auto pos = commands.size();
+    commands.resize(pos + sizeof(header));
+    std::memcpy(commands.data() + pos, &header, sizeof(header));
+}
+
+template <class command_t> void record(std::vector<std::byte> &commands, opcode_t opcode, const command_t &command) {
+    static_assert(std::is_trivially_copyable_v<command_t>);
+
+    const command_header_t header{opcode, sizeof(command_t)};
+    const auto pos = commands.size();
+    commands.resize(pos + sizeof(header) + sizeof(command_t));
+    std::memcpy(commands.data() + pos, &header, sizeof(header));
+    std::memcpy(commands.data() + pos + sizeof(header), &command, sizeof(command_t));
+}
+
+template <class command_t> command_t read(const std::byte *payload) {
+    command_t command;
+    std::memcpy(&command, payload, sizeof(command_t));
+    return command;
+}
+
+arena_range_t store(std::vector<std::byte> &arena, const void *data, size_t size) {
+    const arena_range_t range{arena.size(), size};
+    arena.resize(range.offset + size);
+    if (size > 0) {
+        std::memcpy(arena.data() + range.offset, data, size);
+    }
+    return range;
+}
+
+template <class id_t> arena_range_t store_ids(std::vector<std::byte> &arena, size_t n, const id_t *ids) {
+    const arena_range_t range{arena.size(), n * sizeof(unsigned)};
+    arena.resize(range.offset + range.size);
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned id = ids[i].get_id();
+        std::memcpy(arena.data() + range.offset + i * sizeof(unsigned), &id, sizeof(unsigned));
+    }
+    return range;
+}
+
+template <class id_t> std::vector<id_t> load_ids(const std::vector<std::byte> &arena, arena_range_t range) {
+    std::vector<id_t> ids;
+    ids.reserve(range.size / sizeof(unsigned));
+    for (size_t pos = 0; pos < range.size; pos += sizeof(unsigned)) {
+        unsigned id = 0;
+        std::memcpy(&id, arena.data() + range.offset + pos, sizeof(unsigned));
+        ids.emplace_back(id);
+    }
+    return ids;
+}
+
+size_t image_size(size_t width, size_t height, texture_format_t format,
+                  opengl_cpp::pixel_type_t type = opengl_cpp::pixel_type_t::unsigned_byte) {
+    if (width == 0 || height == 0) {
+        return 0;
+    }
+
+    // Rows are aligned to the default GL_UNPACK_ALIGNMENT of 4 bytes, except for the last one.
+    const size_t row_size = width * opengl_cpp::get_pixel_size(format, type);
+    const size_t row_stride = (row_size + 3) / 4 * 4;
+    return row_stride * (height - 1) + row_size;
+}
+
+pixels_t store_pixels(std::vector<std::byte> &arena, const void *data, size_t size, bool from_buffer) {
+    if (data == nullptr) {
+        return {pixel_source_t::none, {}};
+    }
+    if (from_buffer) {
+        return {pixel_source_t::buffer, {reinterpret_cast<uintptr_t>(data), 0}}; // NOLINT(*-reinterpret-cast)
+    }
+    return {pixel_source_t::arena, store(arena, data, size)};
+}
+
+const std::byte *load_pixels(const std::vector<std::byte> &arena, const pixels_t &pixels) {
+    switch (pixels.source) {
+    case pixel_source_t::arena:
+        return arena.data() + pixels.data.offset;
+    case pixel_source_t::buffer:
+        return reinterpret_cast<const std::byte *>(pixels.data.offset); // NOLINT(*-reinterpret-cast, *-no-int-to-ptr)
+    default:
+        return nullptr;
+    }
+}
+
+[[noreturn]] void not_recordable(const char *call) {
+    throw std::logic_error(std::string(call) + "() cannot be recorded into a command list");
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+void gl_command_list_t::replay(gl_t &gl) const {
+    size_t pos = 0;
+    while (pos < m_commands.size()) {
+        const auto header = read<command_header_t>(m_commands.data() + pos);
+        const auto *payload = m_commands.data() + pos + sizeof(command_header_t);
+        pos += sizeof(command_header_t) + header.size;
+
+        switch (header.opcode) {
+        case opcode_t::activate:
+            gl.activate(*read<object_command_t<texture_t>>(payload).object);
+            break;
+        case opcode_t::attach_shader: {
+            const auto command = read<attach_shader_command_t>(payload);
+            gl.attach_shader(*command.program, *command.shader);
+            break;
+        }
+        case opcode_t::bind_buffer:
+            gl.bind(*read<object_command_t<buffer_t>>(payload).object);
+            break;
+        case opcode_t::bind_texture:
+            gl.bind(*read<object_command_t<texture_t>>(payload).object);
+            break;
+        case opcode_t::bind_vertex_array:
+            gl.bind(*read<object_command_t<vertex_array_t>>(payload).object);
+            break;
+        case opcode_t::buffer_data: {
+            const auto command = read<buffer_data_command_t>(payload);
+            gl.buffer_data(*command.buffer, command.size,
+                           command.has_data ? m_arena.data() + command.data.offset : nullptr, command.usage);
+            break;
+        }
+        case opcode_t::buffer_sub_data: {
+            const auto command = read<buffer_sub_data_command_t>(payload);
+            gl.buffer_sub_data(*command.buffer, command.offset, command.data.size,
+                               m_arena.data() + command.data.offset);
+            break;
+        }
+        case opcode_t::buffer_storage: {
+            const auto command = read<buffer_storage_command_t>(payload);
+            gl.buffer_storage(*command.buffer, command.size,
+                              command.has_data ? m_arena.data() + command.data.offset : nullptr, command.flags);
+            break;
+        }
+        case opcode_t::clear:
+            gl.clear();
+            break;
+        case opcode_t::set_clear_color:
+            gl.set_clear_color(read<value_command_t<glm::vec4>>(payload).value);
+            break;
+        case opcode_t::destroy_buffers: {
+            const auto ids = load_ids<id_buffer_t>(m_arena, read<arena_range_t>(payload));
+            gl.destroy(ids.size(), ids.data());
+            break;
+        }
+        case opcode_t::destroy_program:
+            gl.destroy(id_program_t(read<value_command_t<unsigned>>(payload).value));
+            break;
+        case opcode_t::destroy_shader:
+            gl.destroy(id_shader_t(read<value_command_t<unsigned>>(payload).value));
+            break;
+        case opcode_t::destroy_sync:
+            gl.destroy(read<value_command_t<sync_t>>(payload).value);
+            break;
+        case opcode_t::destroy_textures: {
+            const auto ids = load_ids<id_texture_t>(m_arena, read<arena_range_t>(payload));
+            gl.destroy(ids.size(), ids.data());
+            break;
+        }
+        case opcode_t::destroy_vertex_arrays: {
+            const auto ids = load_ids<id_vertex_array_t>(m_arena, read<arena_range_t>(payload));
+            gl.destroy(ids.size(), ids.data());
+            break;
+        }
+        case opcode_t::destroy_queries: {
+            const auto ids = load_ids<id_query_t>(m_arena, read<arena_range_t>(payload));
+            gl.destroy(ids.size(), ids.data());
+            break;
+        }
+        case opcode_t::disable:
+            gl.disable(read<value_command_t<graphics_feature_t>>(payload).value);
+            break;
+        case opcode_t::draw_arrays: {
+            const auto command = read<draw_arrays_command_t>(payload);
+            gl.draw_arrays(command.first, command.count);
+            break;
+        }
+        case opcode_t::draw_arrays_instanced: {
+            const auto command = read<draw_arrays_instanced_command_t>(payload);
+            gl.draw_arrays_instanced(command.first, command.count, command.instances);
+            break;
+        }
+        case opcode_t::draw_elements: {
+            const auto command = read<draw_elements_command_t>(payload);
+            gl.draw_elements(command.count, command.type, command.offset);
+            break;
+        }
+        case opcode_t::draw_elements_instanced: {
+            const auto command = read<draw_elements_instanced_command_t>(payload);
+            gl.draw_elements_instanced(command.count, command.type, command.offset, command.instances);
+            break;
+        }
+        case opcode_t::multi_draw_arrays_indirect: {
+            const auto command = read<multi_draw_indirect_command_t>(payload);
+            gl.multi_draw_arrays_indirect(command.offset, command.draw_count, command.stride);
+            break;
+        }
+        case opcode_t::multi_draw_elements_indirect: {
+            const auto command = read<multi_draw_indirect_command_t>(payload);
+            gl.multi_draw_elements_indirect(command.type, command.offset, command.draw_count, command.stride);
+            break;
+        }
+        case opcode_t::enable:
+            gl.enable(read<value_command_t<graphics_feature_t>>(payload).value);
+            break;
+        case opcode_t::enable_vertex_attrib_array:
+            gl.enable_vertex_attrib_array(read<value_command_t<unsigned>>(payload).value);
+            break;
+        case opcode_t::generate_mipmap:
+            gl.generate_mipmap(*read<object_command_t<texture_t>>(payload).object);
+            break;
+        case opcode_t::max_shader_compiler_threads:
+            gl.max_shader_compiler_threads(read<value_command_t<unsigned>>(payload).value);
+            break;
+        case opcode_t::polygon_mode:
+            gl.polygon_mode(read<value_command_t<polygon_mode_t>>(payload).value);
+            break;
+        case opcode_t::query_counter:
+            gl.query_counter(id_query_t(read<value_command_t<unsigned>>(payload).value));
+            break;
+        case opcode_t::set_sources: {
+            const auto command = read<set_sources_command_t>(payload);
+            std::vector<const char *> sources;
+            sources.reserve(command.num_sources);
+            const auto *source = reinterpret_cast<const char *>(m_arena.data() + command.sources.offset);
+            for (size_t i = 0; i < command.num_sources; ++i) {
+                sources.push_back(source);
+                source += std::strlen(source) + 1;
+            }
+            gl.set_sources(*command.shader, sources.size(), sources.data(), nullptr);
+            break;
+        }
+        case opcode_t::set_image: {
+            const auto command = read<set_image_command_t>(payload);
+            const auto *data = reinterpret_cast<const unsigned char *>(load_pixels(m_arena, command.pixels));
+            gl.set_image(*command.texture, command.width, command.height, command.format, data);
+            break;
+        }
+        case opcode_t::set_parameter: {
+            const auto command = read<set_parameter_command_t>(payload);
+            gl.set_parameter(*command.texture, command.name, command.value);
+            break;
+        }
+        case opcode_t::set_sub_image: {
+            const auto command = read<set_sub_image_command_t>(payload);
+            gl.set_sub_image(*command.texture, command.level, command.x, command.y, command.width, command.height,
+                             command.format, command.type, load_pixels(m_arena, command.pixels));
+            break;
+        }
+        case opcode_t::set_sub_image_3d: {
+            const auto command = read<set_sub_image_3d_command_t>(payload);
+            gl.set_sub_image_3d(*command.texture, command.level, command.x, command.y, command.z, command.width,
+                                command.height, command.depth, command.format, command.type,
+                                load_pixels(m_arena, command.pixels));
+            break;
+        }
+        case opcode_t::texture_storage: {
+            const auto command = read<texture_storage_command_t>(payload);
+            gl.texture_storage(*command.texture, command.levels, command.format, command.width, command.height);
+            break;
+        }
+        case opcode_t::compressed_image: {
+            const auto command = read<compressed_image_command_t>(payload);
+            gl.compressed_image(*command.texture, command.level, command.format, command.width, command.height,
+                                command.size, load_pixels(m_arena, command.pixels));
+            break;
+        }
+        case opcode_t::compressed_sub_image: {
+            const auto command = read<compressed_image_command_t>(payload);
+            gl.compressed_sub_image(*command.texture, command.level, command.x, command.y, command.width,
+                                    command.height, command.format, command.size, load_pixels(m_arena, command.pixels));
+            break;
+        }
+        case opcode_t::texture_storage_3d: {
+            const auto command = read<texture_storage_command_t>(payload);
+            gl.texture_storage_3d(*command.texture, command.levels, command.format, command.width, command.height,
+                                  command.depth);
+            break;
+        }
+        case opcode_t::set_program_parameter: {
+            const auto command = read<set_program_parameter_command_t>(payload);
+            gl.set_parameter(*command.program, command.param, command.value);
+            break;
+        }
+        case opcode_t::set_uniform_float: {
+            const auto command = read<uniform_command_t<float>>(payload);
+            gl.set_uniform(command.location, command.value);
+            break;
+        }
+        case opcode_t::set_uniform_int: {
+            const auto command = read<uniform_command_t<int>>(payload);
+            gl.set_uniform(command.location, command.value);
+            break;
+        }
+        case opcode_t::set_uniform_array3: {
+            const auto command = read<uniform_command_t<std::array<float, 3>>>(payload);
+            gl.set_uniform(command.location, command.value);
+            break;
+        }
+        case opcode_t::set_uniform_array4: {
+            const auto command = read<uniform_command_t<std::array<float, 4>>>(payload);
+            gl.set_uniform(command.location, command.value);
+            break;
+        }
+        case opcode_t::set_uniform_vec3: {
+            const auto command = read<uniform_command_t<glm::vec3>>(payload);
+            gl.set_uniform(command.location, command.value);
+            break;
+        }
+        case opcode_t::set_uniform_mat4: {
+            const auto command = read<uniform_command_t<glm::mat4>>(payload);
+            gl.set_uniform(command.location, command.value);
+            break;
+        }
+        case opcode_t::unbind_buffer:
+            gl.unbind(read<value_command_t<buffer_target_t>>(payload).value);
+            break;
+        case opcode_t::use:
+            gl.use(*read<object_command_t<program_t>>(payload).object);
+            break;
+        case opcode_t::vertex_attrib_pointer: {
+            const auto command = read<vertex_attrib_pointer_command_t>(payload);
+            gl.vertex_attrib_pointer(command.index, command.size, command.stride, command.offset);
+            break;
+        }
+        case opcode_t::vertex_attrib_pointer_typed: {
+            const auto command = read<vertex_attrib_pointer_typed_command_t>(payload);
+            gl.vertex_attrib_pointer(command.index, command.size, command.type, command.normalized, command.stride,
+                                     command.offset);
+            break;
+        }
+        case opcode_t::vertex_attrib_divisor: {
+            const auto command = read<vertex_attrib_divisor_command_t>(payload);
+            gl.vertex_attrib_divisor(command.index, command.divisor);
+            break;
+        }
+        case opcode_t::set_viewport: {
+            const auto command = read<viewport_command_t>(payload);
+            gl.set_viewport(command.width, command.height);
+            break;
+        }
+        }
+    }
+}
+
+void gl_command_list_t::reset() {
+    m_commands.clear();
+    m_arena.clear();
+    m_pixel_unpack_bound = false;
+}
+
+bool gl_command_list_t::empty() const {
+    return m_commands.empty();
+}
+
+void gl_command_list_t::activate(const texture_t &tex) {
+    record(m_commands, opcode_t::activate, object_command_t<texture_t>{&tex});
+}
+
+void gl_command_list_t::attach_shader(const program_t &p, const shader_t &s) {
+    record(m_commands, opcode_t::attach_shader, attach_shader_command_t{&p, &s});
+}
+
+void gl_command_list_t::bind(const buffer_t &b) {
+    record(m_commands, opcode_t::bind_buffer, object_command_t<buffer_t>{&b});
+    if (b.get_target() == buffer_target_t::pixel_unpack) {
+        m_pixel_unpack_bound = true;
+    }
+}
+
+void gl_command_list_t::bind(const texture_t &t) {
+    record(m_commands, opcode_t::bind_texture, object_command_t<texture_t>{&t});
+}
+
+void gl_command_list_t::bind(const vertex_array_t &va) {
+    record(m_commands, opcode_t::bind_vertex_array, object_command_t<vertex_array_t>{&va});
+}
+
+void gl_command_list_t::buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) {
+    const auto range = data != nullptr ? store(m_arena, data, size) : arena_range_t{};
+    record(m_commands, opcode_t::buffer_data, buffer_data_command_t{&b, size, data != nullptr, range, usage});
+}
+
+void gl_command_list_t::buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) {
+    record(m_commands, opcode_t::buffer_sub_data, buffer_sub_data_command_t{&b, offset, store(m_arena, data, size)});
+}
+
+void gl_command_list_t::buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) {
+    const auto range = data != nullptr ? store(m_arena, data, size) : arena_range_t{};
+    record(m_commands, opcode_t::buffer_storage, buffer_storage_command_t{&b, size, data != nullptr, range, flags});
+}
+
+void gl_command_list_t::clear() {
+    record(m_commands, opcode_t::clear);
+}
+
+void gl_command_list_t::set_clear_color(const glm::vec4 &c) {
+    record(m_commands, opcode_t::set_clear_color, value_command_t<glm::vec4>{c});
+}
+
+error_t gl_command_list_t::compile(const shader_t &) {
+    not_recordable("compile");
+}
+
+id_program_t gl_command_list_t::new_program() {
+    not_recordable("new_program");
+}
+
+id_shader_t gl_command_list_t::new_shader(shader_type_t) {
+    not_recordable("new_shader");
+}
+
+void gl_command_list_t::destroy(size_t n, const id_buffer_t *buffers) {
+    record(m_commands, opcode_t::destroy_buffers, store_ids(m_arena, n, buffers));
+}
+
+void gl_command_list_t::destroy(sync_t sync) {
+    record(m_commands, opcode_t::destroy_sync, value_command_t<sync_t>{sync});
+}
+
+void gl_command_list_t::destroy(const id_program_t &program) {
+    record(m_commands, opcode_t::destroy_program, value_command_t<unsigned>{program.get_id()});
+}
+
+void gl_command_list_t::destroy(const id_shader_t &shader) {
+    record(m_commands, opcode_t::destroy_shader, value_command_t<unsigned>{shader.get_id()});
+}
+
+void gl_command_list_t::destroy(size_t n, const id_texture_t *textures) {
+    record(m_commands, opcode_t::destroy_textures, store_ids(m_arena, n, textures));
+}
+
+void gl_command_list_t::destroy(size_t n, const id_vertex_array_t *arrays) {
+    record(m_commands, opcode_t::destroy_vertex_arrays, store_ids(m_arena, n, arrays));
+}
+
+void gl_command_list_t::destroy(size_t n, const id_query_t *queries) {
+    record(m_commands, opcode_t::destroy_queries, store_ids(m_arena, n, queries));
+}
+
+void gl_command_list_t::disable(graphics_feature_t cap) {
+    record(m_commands, opcode_t::disable, value_command_t<graphics_feature_t>{cap});
+}
+
+sync_t gl_command_list_t::fence_sync() {
+    not_recordable("fence_sync");
+}
+
+sync_status_t gl_command_list_t::client_wait_sync(sync_t, uint64_t) {
+    not_recordable("client_wait_sync");
+}
+
+void gl_command_list_t::draw_arrays(int first, size_t count) {
+    record(m_commands, opcode_t::draw_arrays, draw_arrays_command_t{first, count});
+}
+
+void gl_command_list_t::draw_arrays_instanced(int first, size_t count, size_t instances) {
+    record(m_commands, opcode_t::draw_arrays_instanced, draw_arrays_instanced_command_t{first, count, instances});
+}
+
+void gl_command_list_t::draw_elements(size_t count, index_type_t type, size_t offset) {
+    record(m_commands, opcode_t::draw_elements, draw_elements_command_t{count, type, offset});
+}
+
+void gl_command_list_t::draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) {
+    record(m_commands, opcode_t::draw_elements_instanced,
+           draw_elements_instanced_command_t{count, type, offset, instances});
+}
+
+void gl_command_list_t::multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) {
+    record(m_commands, opcode_t::multi_draw_arrays_indirect,
+           multi_draw_indirect_command_t{index_type_t::undefined, offset, draw_count, stride});
+}
+
+void gl_command_list_t::multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count,
+                                                     size_t stride) {
+    record(m_commands, opcode_t::multi_draw_elements_indirect,
+           multi_draw_indirect_command_t{type, offset, draw_count, stride});
+}
+
+void gl_command_list_t::enable(graphics_feature_t cap) {
+    record(m_commands, opcode_t::enable, value_command_t<graphics_feature_t>{cap});
+}
+
+void gl_command_list_t::enable_vertex_attrib_array(unsigned index) {
+    record(m_commands, opcode_t::enable_vertex_attrib_array, value_command_t<unsigned>{index});
+}
+
+std::vector<id_buffer_t> gl_command_list_t::new_buffers(size_t) {
+    not_recordable("new_buffers");
+}
+
+std::vector<id_texture_t> gl_command_list_t::new_textures(size_t) {
+    not_recordable("new_textures");
+}
+
+std::vector<id_vertex_array_t> gl_command_list_t::new_vertex_arrays(size_t) {
+    not_recordable("new_vertex_arrays");
+}
+
+std::vector<id_query_t> gl_command_list_t::new_queries(size_t) {
+    not_recordable("new_queries");
+}
+
+void gl_command_list_t::generate_mipmap(const texture_t &t) {
+    record(m_commands, opcode_t::generate_mipmap, object_command_t<texture_t>{&t});
+}
+
+std::string gl_command_list_t::get_active_uniform(const program_t &, unsigned) {
+    not_recordable("get_active_uniform");
+}
+
+std::string gl_command_list_t::get_info_log(const program_t &) {
+    not_recordable("get_info_log");
+}
+
+int gl_command_list_t::get_parameter(const program_t &, program_parameter_t) {
+    not_recordable("get_parameter");
+}
+
+std::string gl_command_list_t::get_info_log(const shader_t &) {
+    not_recordable("get_info_log");
+}
+
+uint64_t gl_command_list_t::get_query_result(const id_query_t &) {
+    not_recordable("get_query_result");
+}
+
+int64_t gl_command_list_t::get_timestamp() {
+    not_recordable("get_timestamp");
+}
+
+int gl_command_list_t::get_parameter(const shader_t &, shader_parameter_t) {
+    not_recordable("get_parameter");
+}
+
+program_binary_t gl_command_list_t::get_program_binary(const program_t &) {
+    not_recordable("get_program_binary");
+}
+
+std::string gl_command_list_t::get_string(string_name_t) {
+    not_recordable("get_string");
+}
+
+int gl_command_list_t::get_uniform_location(const program_t &, const char *) {
+    not_recordable("get_uniform_location");
+}
+
+bool gl_command_list_t::has_extension(extension_t) {
+    not_recordable("has_extension");
+}
+
+bool gl_command_list_t::is_query_result_available(const id_query_t &) {
+    not_recordable("is_query_result_available");
+}
+
+error_t gl_command_list_t::link(const program_t &) {
+    not_recordable("link");
+}
+
+error_t gl_command_list_t::program_binary(const program_t &, const program_binary_t &) {
+    not_recordable("program_binary");
+}
+
+void *gl_command_list_t::map_buffer_range(const buffer_t &, size_t, size_t, buffer_access_t) {
+    not_recordable("map_buffer_range");
+}
+
+void gl_command_list_t::max_shader_compiler_threads(unsigned count) {
+    record(m_commands, opcode_t::max_shader_compiler_threads, value_command_t<unsigned>{count});
+}
+
+void gl_command_list_t::polygon_mode(polygon_mode_t mode) {
+    record(m_commands, opcode_t::polygon_mode, value_command_t<polygon_mode_t>{mode});
+}
+
+void gl_command_list_t::query_counter(const id_query_t &q) {
+    record(m_commands, opcode_t::query_counter, value_command_t<unsigned>{q.get_id()});
+}
+
+void gl_command_list_t::set_sources(const shader_t &s, size_t num_sources, const char **sources,
+                                    const int *lengths) {
+    // Sources are stored null terminated, so they are replayed without lengths.
+    const arena_range_t range{m_arena.size(), 0};
+    for (size_t i = 0; i < num_sources; ++i) {
+        const auto length = lengths != nullptr ? static_cast<size_t>(lengths[i]) : std::strlen(sources[i]);
+        store(m_arena, sources[i], length);
+        m_arena.push_back(std::byte{0});
+    }
+    record(m_commands, opcode_t::set_sources,
+           set_sources_command_t{&s, num_sources, arena_range_t{range.offset, m_arena.size() - range.offset}});
+}
+
+void gl_command_list_t::set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                                  const unsigned char *data) {
+    const auto pixels = store_pixels(m_arena, data, image_size(width, height, format), m_pixel_unpack_bound);
+    record(m_commands, opcode_t::set_image, set_image_command_t{&t, width, height, format, pixels});
+}
+
+void gl_command_list_t::set_parameter(const texture_t &t, texture_parameter_t name, texture_parameter_values_t value) {
+    record(m_commands, opcode_t::set_parameter, set_parameter_command_t{&t, name, value});
+}
+
+void gl_command_list_t::set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                                      texture_format_t format, pixel_type_t type, const void *data) {
+    const auto pixels = store_pixels(m_arena, data, image_size(width, height, format, type), m_pixel_unpack_bound);
+    record(m_commands, opcode_t::set_sub_image,
+           set_sub_image_command_t{&t, level, x, y, width, height, format, type, pixels});
+}
+
+void gl_command_list_t::set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width,
+                                         size_t height, size_t depth, texture_format_t format, pixel_type_t type,
+                                         const void *data) {
+    // Layers are stacked as if they were one taller image, rows keep being aligned across them.
+    const auto size = image_size(width, height * depth, format, type);
+    const auto pixels = store_pixels(m_arena, data, size, m_pixel_unpack_bound);
+    record(m_commands, opcode_t::set_sub_image_3d,
+           set_sub_image_3d_command_t{&t, level, x, y, z, width, height, depth, format, type, pixels});
+}
+
+void gl_command_list_t::texture_storage(const texture_t &t, size_t levels, texture_internal_format_t format,
+                                        size_t width, size_t height) {
+    record(m_commands, opcode_t::texture_storage, texture_storage_command_t{&t, levels, format, width, height, 1});
+}
+
+void gl_command_list_t::texture_storage_3d(const texture_t &t, size_t levels, texture_internal_format_t format,
+                                           size_t width, size_t height, size_t depth) {
+    record(m_commands, opcode_t::texture_storage_3d,
+           texture_storage_command_t{&t, levels, format, width, height, depth});
+}
+
+void gl_command_list_t::compressed_image(const texture_t &t, int level, texture_internal_format_t format,
+                                         size_t width, size_t height, size_t size, const void *data) {
+    const auto pixels = store_pixels(m_arena, data, size, m_pixel_unpack_bound);
+    record(m_commands, opcode_t::compressed_image,
+           compressed_image_command_t{&t, level, 0, 0, width, height, format, size, pixels});
+}
+
+void gl_command_list_t::compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width,
+                                             size_t height, texture_internal_format_t format, size_t size,
+                                             const void *data) {
+    const auto pixels = store_pixels(m_arena, data, size, m_pixel_unpack_bound);
+    record(m_commands, opcode_t::compressed_sub_image,
+           compressed_image_command_t{&t, level, x, y, width, height, format, size, pixels});
+}
+
+void gl_command_list_t::set_parameter(const program_t &p, program_parameter_t param, int value) {
+    record(m_commands, opcode_t::set_program_parameter, set_program_parameter_command_t{&p, param, value});
+}
+
+void gl_command_list_t::set_uniform(int location, float v0) {
+    record(m_commands, opcode_t::set_uniform_float, uniform_command_t<float>{location, v0});
+}
+
+void gl_command_list_t::set_uniform(int location, int v0) {
+    record(m_commands, opcode_t::set_uniform_int, uniform_command_t<int>{location, v0});
+}
+
+void gl_command_list_t::set_uniform(int location, const std::array<float, 3> &v) {
+    record(m_commands, opcode_t::set_uniform_array3, uniform_command_t<std::array<float, 3>>{location, v});
+}
+
+void gl_command_list_t::set_uniform(int location, const glm::vec3 &v) {
+    record(m_commands, opcode_t::set_uniform_vec3, uniform_command_t<glm::vec3>{location, v});
+}
+
+void gl_command_list_t::set_uniform(int location, const std::array<float, 4> &v) {
+    record(m_commands, opcode_t::set_uniform_array4, uniform_command_t<std::array<float, 4>>{location, v});
+}
+
+void gl_command_list_t::set_uniform(int location, const glm::mat4 &value) {
+    record(m_commands, opcode_t::set_uniform_mat4, uniform_command_t<glm::mat4>{location, value});
+}
+
+bool gl_command_list_t::unmap_buffer(const buffer_t &) {
+    not_recordable("unmap_buffer");
+}
+
+void gl_command_list_t::unbind(buffer_target_t target) {
+    record(m_commands, opcode_t::unbind_buffer, value_command_t<buffer_target_t>{target});
+    if (target == buffer_target_t::pixel_unpack) {
+        m_pixel_unpack_bound = false;
+    }
+}
+
+void gl_command_list_t::use(const program_t &p) {
+    record(m_commands, opcode_t::use, object_command_t<program_t>{&p});
+}
+
+void gl_command_list_t::vertex_attrib_pointer(unsigned index, size_t size, size_t stride, unsigned offset) {
+    record(m_commands, opcode_t::vertex_attrib_pointer, vertex_attrib_pointer_command_t{index, size, stride, offset});
+}
+
+void gl_command_list_t::vertex_attrib_pointer(unsigned index, size_t size, vertex_attrib_type_t type, bool normalized,
+                                              size_t stride, unsigned offset) {
+    record(m_commands, opcode_t::vertex_attrib_pointer_typed,
+           vertex_attrib_pointer_typed_command_t{index, size, type, normalized, stride, offset});
+}
+
+void gl_command_list_t::vertex_attrib_divisor(unsigned index, unsigned divisor) {
+    record(m_commands, opcode_t::vertex_attrib_divisor, vertex_attrib_divisor_command_t{index, divisor});
+}
+
+void gl_command_list_t::set_viewport(size_t width, size_t height) {
+    record(m_commands, opcode_t::set_viewport, viewport_command_t{width, height});
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,256 @@
+#include "opengl-cpp/backend/gl_counters.h"
+
+#include "program.h"
+
+#include <cassert>
+#include <fstream>
+#include <stdexcept>
+
+namespace opengl_cpp {
+
+gl_counters_t::gl_counters_t(gl_t &gl, size_t history) : gl_decorator_t(gl), m_max_history(history) {
+    assert(history > 0);
+}
+
+void gl_counters_t::end_frame() {
+    if (m_history.size() == m_max_history) {
+        m_history.pop_front();
+    }
+    m_history.push_back(m_current);
+    m_current = {};
+    m_current.m_frame = m_history.back().m_frame + 1;
+}
+
+const gl_frame_counters_t &gl_counters_t::get_current() const {
+    return m_current;
+}
+
+std::vector<gl_frame_counters_t> gl_counters_t::get_history() const {
+    return {m_history.begin(), m_history.end()};
+}
+
+void gl_counters_t::write_csv(std::ostream &os) const {
+    os << "frame,draw_calls,vertices,buffer_binds,texture_binds,vertex_array_binds,program_switches,uniform_updates,"
+          "buffer_bytes,texture_bytes,objects_created,objects_destroyed\n";
+    for (const auto &f : m_history) {
+        os << f.m_frame << ',' << f.m_draw_calls << ',' << f.m_vertices << ',' << f.m_buffer_binds << ','
+           << f.m_texture_binds << ',' << f.m_vertex_array_binds << ',' << f.m_program_switches << ','
+           << f.m_uniform_updates << ',' << f.m_buffer_bytes << ',' << f.m_texture_bytes << ',' << f.m_objects_created
+           << ',' << f.m_objects_destroyed << '\n';
+    }
+}
+
+void gl_counters_t::write_csv(const std::filesystem::path &path) const {
+    std::ofstream file(path, std::ios::trunc);
+    write_csv(file);
+    if (!file) {
+        throw std::runtime_error("cannot write counters file: " + path.string());
+    }
+}
+
+id_program_t gl_counters_t::new_program() {
+    ++m_current.m_objects_created;
+    return m_gl.new_program();
+}
+
+id_shader_t gl_counters_t::new_shader(shader_type_t type) {
+    ++m_current.m_objects_created;
+    return m_gl.new_shader(type);
+}
+
+std::vector<id_buffer_t> gl_counters_t::new_buffers(size_t n) {
+    m_current.m_objects_created += n;
+    return m_gl.new_buffers(n);
+}
+
+std::vector<id_texture_t> gl_counters_t::new_textures(size_t n) {
+    m_current.m_objects_created += n;
+    return m_gl.new_textures(n);
+}
+
+std::vector<id_vertex_array_t> gl_counters_t::new_vertex_arrays(size_t n) {
+    m_current.m_objects_created += n;
+    return m_gl.new_vertex_arrays(n);
+}
+
+std::vector<id_query_t> gl_counters_t::new_queries(size_t n) {
+    m_current.m_objects_created += n;
+    return m_gl.new_queries(n);
+}
+
+void gl_counters_t::destroy(size_t n, const id_buffer_t *buffers) {
+    m_current.m_objects_destroyed += n;
+    m_gl.destroy(n, buffers);
+}
+
+void gl_counters_t::destroy(const id_program_t &program) {
+    // The name may be handed out again to another program.
+    if (m_program == program.get_id()) {
+        m_program.reset();
+    }
+    ++m_current.m_objects_destroyed;
+    m_gl.destroy(program);
+}
+
+void gl_counters_t::destroy(const id_shader_t &shader) {
+    ++m_current.m_objects_destroyed;
+    m_gl.destroy(shader);
+}
+
+void gl_counters_t::destroy(size_t n, const id_texture_t *textures) {
+    m_current.m_objects_destroyed += n;
+    m_gl.destroy(n, textures);
+}
+
+void gl_counters_t::destroy(size_t n, const id_vertex_array_t *arrays) {
+    m_current.m_objects_destroyed += n;
+    m_gl.destroy(n, arrays);
+}
+
+void gl_counters_t::destroy(size_t n, const id_query_t *queries) {
+    m_current.m_objects_destroyed += n;
+    m_gl.destroy(n, queries);
+}
+
+void gl_counters_t::bind(const buffer_t &b) {
+    ++m_current.m_buffer_binds;
+    m_gl.bind(b);
+}
+
+void gl_counters_t::bind(const texture_t &t) {
+    ++m_current.m_texture_binds;
+    m_gl.bind(t);
+}
+
+void gl_counters_t::bind(const vertex_array_t &va) {
+    ++m_current.m_vertex_array_binds;
+    m_gl.bind(va);
+}
+
+void gl_counters_t::use(const program_t &p) {
+    if (m_program != p.get_id().get_id()) {
+        ++m_current.m_program_switches;
+        m_program = p.get_id();
+    }
+    m_gl.use(p);
+}
+
+void gl_counters_t::buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) {
+    m_current.m_buffer_bytes += data != nullptr ? size : 0;
+    m_gl.buffer_data(b, size, data, usage);
+}
+
+void gl_counters_t::buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) {
+    m_current.m_buffer_bytes += size;
+    m_gl.buffer_sub_data(b, offset, size, data);
+}
+
+void gl_counters_t::buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) {
+    m_current.m_buffer_bytes += data != nullptr ? size : 0;
+    m_gl.buffer_storage(b, size, data, flags);
+}
+
+void gl_counters_t::compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width,
+                                     size_t height, size_t size, const void *data) {
+    m_current.m_texture_bytes += size;
+    m_gl.compressed_image(t, level, format, width, height, size, data);
+}
+
+void gl_counters_t::compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width,
+                                         size_t height, texture_internal_format_t format, size_t size,
+                                         const void *data) {
+    m_current.m_texture_bytes += size;
+    m_gl.compressed_sub_image(t, level, x, y, width, height, format, size, data);
+}
+
+void gl_counters_t::set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                              const unsigned char *data) {
+    m_current.m_texture_bytes +=
+        data != nullptr ? width * height * get_pixel_size(format, pixel_type_t::unsigned_byte) : 0;
+    m_gl.set_image(t, width, height, format, data);
+}
+
+void gl_counters_t::set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                                  texture_format_t format, pixel_type_t type, const void *data) {
+    m_current.m_texture_bytes += width * height * get_pixel_size(format, type);
+    m_gl.set_sub_image(t, level, x, y, width, height, format, type, data);
+}
+
+void gl_counters_t::set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width,
+                                     size_t height, size_t depth, texture_format_t format, pixel_type_t type,
+                                     const void *data) {
+    m_current.m_texture_bytes += width * height * depth * get_pixel_size(format, type);
+    m_gl.set_sub_image_3d(t, level, x, y, z, width, height, depth, format, type, data);
+}
+
+void gl_counters_t::draw_arrays(int first, size_t count) {
+    ++m_current.m_draw_calls;
+    m_current.m_vertices += count;
+    m_gl.draw_arrays(first, count);
+}
+
+void gl_counters_t::draw_arrays_instanced(int first, size_t count, size_t instances) {
+    ++m_current.m_draw_calls;
+    m_current.m_vertices += count * instances;
+    m_gl.draw_arrays_instanced(first, count, instances);
+}
+
+void gl_counters_t::draw_elements(size_t count, index_type_t type, size_t offset) {
+    ++m_current.m_draw_calls;
+    m_current.m_vertices += count;
+    m_gl.draw_elements(count, type, offset);
+}
+
+void gl_counters_t::draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) {
+    ++m_current.m_draw_calls;
+    m_current.m_vertices += count * instances;
+    m_gl.draw_elements_instanced(count, type, offset, instances);
+}
+
+void gl_counters_t::multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) {
+    m_current.m_draw_calls += draw_count;
+    m_gl.multi_draw_arrays_indirect(offset, draw_count, stride);
+}
+
+void gl_counters_t::multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) {
+    m_current.m_draw_calls += draw_count;
+    m_gl.multi_draw_elements_indirect(type, offset, draw_count, stride);
+}
+
+void gl_counters_t::set_uniform(int location, float v0) {
+    ++m_current.m_uniform_updates;
+    m_gl.set_uniform(location, v0);
+}
+
+void gl_counters_t::set_uniform(int location, int v0) {
+    ++m_current.m_uniform_updates;
+    m_gl.set_uniform(location, v0);
+}
+
+void gl_counters_t::set_uniform(int location, const glm::vec3 &v) {
+    ++m_current.m_uniform_updates;
+    m_gl.set_uniform(location, v);
+}
+
+void gl_counters_t::set_uniform(int location, const std::array<float, 3> &v) {
+    ++m_current.m_uniform_updates;
+    m_gl.set_uniform(location, v);
+}
+
+void gl_counters_t::set_uniform(int location, const std::array<float, 4> &v) {
+    ++m_current.m_uniform_updates;
+    m_gl.set_uniform(location, v);
+}
+
+void gl_counters_t::set_uniform(int location, const glm::mat4 &value) {
+    ++m_current.m_uniform_updates;
+    m_gl.set_uniform(location, value);
+}
+
+std::ostream &operator<<(std::ostream &os, const gl_counters_t &c) {
+    const auto &f = c.get_current();
+    return os << "gl_counters(" << &c << ") frame=" << f.m_frame << ", draw_calls=" << f.m_draw_calls
+              << ", vertices=" << f.m_vertices;
+}
+
+} // namespace opengl_cpp
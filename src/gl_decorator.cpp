@@ -0,0 +1,326 @@
+#include "opengl-cpp/backend/gl_decorator.h"
+
+namespace opengl_cpp {
+
+gl_decorator_t::gl_decorator_t(gl_t &gl) : m_gl(gl) {
+}
+
+void gl_decorator_t::activate(const texture_t &tex) {
+    m_gl.activate(tex);
+}
+
+void gl_decorator_t::attach_shader(const program_t &p, const shader_t &s) {
+    m_gl.attach_shader(p, s);
+}
+
+void gl_decorator_t::bind(const buffer_t &b) {
+    m_gl.bind(b);
+}
+
+void gl_decorator_t::bind(const texture_t &t) {
+    m_gl.bind(t);
+}
+
+void gl_decorator_t::bind(const vertex_array_t &va) {
+    m_gl.bind(va);
+}
+
+void gl_decorator_t::buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) {
+    m_gl.buffer_data(b, size, data, usage);
+}
+
+void gl_decorator_t::buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) {
+    m_gl.buffer_sub_data(b, offset, size, data);
+}
+
+void gl_decorator_t::buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) {
+    m_gl.buffer_storage(b, size, data, flags);
+}
+
+void gl_decorator_t::clear() {
+    m_gl.clear();
+}
+
+void gl_decorator_t::set_clear_color(const glm::vec4 &c) {
+    m_gl.set_clear_color(c);
+}
+
+error_t gl_decorator_t::compile(const shader_t &s) {
+    return m_gl.compile(s);
+}
+
+id_program_t gl_decorator_t::new_program() {
+    return m_gl.new_program();
+}
+
+id_shader_t gl_decorator_t::new_shader(shader_type_t type) {
+    return m_gl.new_shader(type);
+}
+
+void gl_decorator_t::destroy(size_t n, const id_buffer_t *buffers) {
+    m_gl.destroy(n, buffers);
+}
+
+void gl_decorator_t::destroy(sync_t sync) {
+    m_gl.destroy(sync);
+}
+
+void gl_decorator_t::destroy(const id_program_t &program) {
+    m_gl.destroy(program);
+}
+
+void gl_decorator_t::destroy(const id_shader_t &shader) {
+    m_gl.destroy(shader);
+}
+
+void gl_decorator_t::destroy(size_t n, const id_texture_t *textures) {
+    m_gl.destroy(n, textures);
+}
+
+void gl_decorator_t::destroy(size_t n, const id_vertex_array_t *arrays) {
+    m_gl.destroy(n, arrays);
+}
+
+void gl_decorator_t::destroy(size_t n, const id_query_t *queries) {
+    m_gl.destroy(n, queries);
+}
+
+void gl_decorator_t::disable(graphics_feature_t cap) {
+    m_gl.disable(cap);
+}
+
+sync_t gl_decorator_t::fence_sync() {
+    return m_gl.fence_sync();
+}
+
+sync_status_t gl_decorator_t::client_wait_sync(sync_t sync, uint64_t timeout) {
+    return m_gl.client_wait_sync(sync, timeout);
+}
+
+void gl_decorator_t::draw_arrays(int first, size_t count) {
+    m_gl.draw_arrays(first, count);
+}
+
+void gl_decorator_t::draw_arrays_instanced(int first, size_t count, size_t instances) {
+    m_gl.draw_arrays_instanced(first, count, instances);
+}
+
+void gl_decorator_t::draw_elements(size_t count, index_type_t type, size_t offset) {
+    m_gl.draw_elements(count, type, offset);
+}
+
+void gl_decorator_t::draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) {
+    m_gl.draw_elements_instanced(count, type, offset, instances);
+}
+
+void gl_decorator_t::multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) {
+    m_gl.multi_draw_arrays_indirect(offset, draw_count, stride);
+}
+
+void gl_decorator_t::multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) {
+    m_gl.multi_draw_elements_indirect(type, offset, draw_count, stride);
+}
+
+void gl_decorator_t::enable(graphics_feature_t cap) {
+    m_gl.enable(cap);
+}
+
+void gl_decorator_t::enable_vertex_attrib_array(unsigned index) {
+    m_gl.enable_vertex_attrib_array(index);
+}
+
+std::vector<id_buffer_t> gl_decorator_t::new_buffers(size_t n) {
+    return m_gl.new_buffers(n);
+}
+
+std::vector<id_texture_t> gl_decorator_t::new_textures(size_t n) {
+    return m_gl.new_textures(n);
+}
+
+std::vector<id_vertex_array_t> gl_decorator_t::new_vertex_arrays(size_t n) {
+    return m_gl.new_vertex_arrays(n);
+}
+
+std::vector<id_query_t> gl_decorator_t::new_queries(size_t n) {
+    return m_gl.new_queries(n);
+}
+
+void gl_decorator_t::generate_mipmap(const texture_t &t) {
+    m_gl.generate_mipmap(t);
+}
+
+std::string gl_decorator_t::get_active_uniform(const program_t &p, unsigned index) {
+    return m_gl.get_active_uniform(p, index);
+}
+
+std::string gl_decorator_t::get_info_log(const program_t &p) {
+    return m_gl.get_info_log(p);
+}
+
+int gl_decorator_t::get_parameter(const program_t &p, program_parameter_t param) {
+    return m_gl.get_parameter(p, param);
+}
+
+std::string gl_decorator_t::get_info_log(const shader_t &s) {
+    return m_gl.get_info_log(s);
+}
+
+uint64_t gl_decorator_t::get_query_result(const id_query_t &q) {
+    return m_gl.get_query_result(q);
+}
+
+int64_t gl_decorator_t::get_timestamp() {
+    return m_gl.get_timestamp();
+}
+
+int gl_decorator_t::get_parameter(const shader_t &s, shader_parameter_t param) {
+    return m_gl.get_parameter(s, param);
+}
+
+program_binary_t gl_decorator_t::get_program_binary(const program_t &p) {
+    return m_gl.get_program_binary(p);
+}
+
+std::string gl_decorator_t::get_string(string_name_t name) {
+    return m_gl.get_string(name);
+}
+
+int gl_decorator_t::get_uniform_location(const program_t &p, const char *name) {
+    return m_gl.get_uniform_location(p, name);
+}
+
+bool gl_decorator_t::has_extension(extension_t ext) {
+    return m_gl.has_extension(ext);
+}
+
+bool gl_decorator_t::is_query_result_available(const id_query_t &q) {
+    return m_gl.is_query_result_available(q);
+}
+
+error_t gl_decorator_t::link(const program_t &p) {
+    return m_gl.link(p);
+}
+
+error_t gl_decorator_t::program_binary(const program_t &p, const program_binary_t &binary) {
+    return m_gl.program_binary(p, binary);
+}
+
+void *gl_decorator_t::map_buffer_range(const buffer_t &b, size_t offset, size_t length, buffer_access_t access) {
+    return m_gl.map_buffer_range(b, offset, length, access);
+}
+
+void gl_decorator_t::max_shader_compiler_threads(unsigned count) {
+    m_gl.max_shader_compiler_threads(count);
+}
+
+void gl_decorator_t::polygon_mode(polygon_mode_t mode) {
+    m_gl.polygon_mode(mode);
+}
+
+void gl_decorator_t::query_counter(const id_query_t &q) {
+    m_gl.query_counter(q);
+}
+
+void gl_decorator_t::set_sources(const shader_t &s, size_t num_sources, const char **sources, const int *lengths) {
+    m_gl.set_sources(s, num_sources, sources, lengths);
+}
+
+void gl_decorator_t::set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                               const unsigned char *data) {
+    m_gl.set_image(t, width, height, format, data);
+}
+
+void gl_decorator_t::set_parameter(const texture_t &t, texture_parameter_t name, texture_parameter_values_t value) {
+    m_gl.set_parameter(t, name, value);
+}
+
+void gl_decorator_t::set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                                   texture_format_t format, pixel_type_t type, const void *data) {
+    m_gl.set_sub_image(t, level, x, y, width, height, format, type, data);
+}
+
+void gl_decorator_t::set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width,
+                                      size_t height, size_t depth, texture_format_t format, pixel_type_t type,
+                                      const void *data) {
+    m_gl.set_sub_image_3d(t, level, x, y, z, width, height, depth, format, type, data);
+}
+
+void gl_decorator_t::texture_storage(const texture_t &t, size_t levels, texture_internal_format_t format,
+                                     size_t width, size_t height) {
+    m_gl.texture_storage(t, levels, format, width, height);
+}
+
+void gl_decorator_t::texture_storage_3d(const texture_t &t, size_t levels, texture_internal_format_t format,
+                                        size_t width, size_t height, size_t depth) {
+    m_gl.texture_storage_3d(t, levels, format, width, height, depth);
+}
+
+void gl_decorator_t::compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width,
+                                      size_t height, size_t size, const void *data) {
+    m_gl.compressed_image(t, level, format, width, height, size, data);
+}
+
+void gl_decorator_t::compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width,
+                                          size_t height, texture_internal_format_t format, size_t size,
+                                          const void *data) {
+    m_gl.compressed_sub_image(t, level, x, y, width, height, format, size, data);
+}
+
+void gl_decorator_t::set_parameter(const program_t &p, program_parameter_t param, int value) {
+    m_gl.set_parameter(p, param, value);
+}
+
+void gl_decorator_t::set_uniform(int location, float v0) {
+    m_gl.set_uniform(location, v0);
+}
+
+void gl_decorator_t::set_uniform(int location, int v0) {
+    m_gl.set_uniform(location, v0);
+}
+
+void gl_decorator_t::set_uniform(int location, const std::array<float, 3> &v) {
+    m_gl.set_uniform(location, v);
+}
+
+void gl_decorator_t::set_uniform(int location, const glm::vec3 &v) {
+    m_gl.set_uniform(location, v);
+}
+
+void gl_decorator_t::set_uniform(int location, const std::array<float, 4> &v) {
+    m_gl.set_uniform(location, v);
+}
+
+void gl_decorator_t::set_uniform(int location, const glm::mat4 &value) {
+    m_gl.set_uniform(location, value);
+}
+
+bool gl_decorator_t::unmap_buffer(const buffer_t &b) {
+    return m_gl.unmap_buffer(b);
+}
+
+void gl_decorator_t::unbind(buffer_target_t target) {
+    m_gl.unbind(target);
+}
+
+void gl_decorator_t::use(const program_t &p) {
+    m_gl.use(p);
+}
+
+void gl_decorator_t::vertex_attrib_pointer(unsigned index, size_t size, size_t stride, unsigned offset) {
+    m_gl.vertex_attrib_pointer(index, size, stride, offset);
+}
+
+void gl_decorator_t::vertex_attrib_pointer(unsigned index, size_t size, vertex_attrib_type_t type, bool normalized,
+                                           size_t stride, unsigned offset) {
+    m_gl.vertex_attrib_pointer(index, size, type, normalized, stride, offset);
+}
+
+void gl_decorator_t::vertex_attrib_divisor(unsigned index, unsigned divisor) {
+    m_gl.vertex_attrib_divisor(index, divisor);
+}
+
+void gl_decorator_t::set_viewport(size_t width, size_t height) {
+    m_gl.set_viewport(width, height);
+}
+
+} // namespace opengl_cpp
@@ -5,7 +5,55 @@
 #include "shader.h"
 #include "texture.h"
 #include "vertex_array.h"
+#include <algorithm>
 #include <glm/gtc/type_ptr.hpp>
+#include <utility>
+
+namespace {
+
+constexpr size_t delete_chunk_size = 64;
+
+// Copies the names into a stack buffer, so deleting does not allocate.
+template <class id_t, class delete_t> void delete_names(size_t n, const id_t *ids, delete_t gl_delete) {
+    std::array<GLuint, delete_chunk_size> names{};
+    for (size_t first = 0; first < n; first += names.size()) {
+        const auto count = std::min(names.size(), n - first);
+        for (size_t i = 0; i < count; ++i) {
+            names[i] = ids[first + i].get_id();
+        }
+        gl_delete(static_cast<GLsizei>(count), names.data());
+    }
+}
+
+// Offsets inside the bound buffer are passed where the API used to take client memory pointers.
+const void *buffer_offset(size_t offset) {
+    return reinterpret_cast<const void *>(offset); // NOLINT(*-reinterpret-cast, performance-no-int-to-ptr)
+}
+
+// Format and type glTexImage2D accepts along with a sized internal format when no pixels are given.
+std::pair<GLenum, GLenum> storage_upload_format(opengl_cpp::texture_internal_format_t format) {
+    using opengl_cpp::texture_internal_format_t;
+
+    switch (format) {
+    case texture_internal_format_t::r8:
+    case texture_internal_format_t::r16f:
+    case texture_internal_format_t::r32f:
+        return {GL_RED, GL_UNSIGNED_BYTE};
+    case texture_internal_format_t::rg8:
+    case texture_internal_format_t::rg16f:
+    case texture_internal_format_t::rg32f:
+        return {GL_RG, GL_UNSIGNED_BYTE};
+    case texture_internal_format_t::rgb8:
+    case texture_internal_format_t::srgb8:
+        return {GL_RGB, GL_UNSIGNED_BYTE};
+    case texture_internal_format_t::depth24_stencil8:
+        return {GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8};
+    default:
+        return {GL_RGBA, GL_UNSIGNED_BYTE};
+    }
+}
+
+} // namespace
 
 namespace opengl_cpp {
 
@@ -29,8 +77,16 @@ void gl_impl_t::bind(const vertex_array_t &va) {
     glBindVertexArray(va.get_id());
 }
 
-void gl_impl_t::buffer_data(const buffer_t &b, size_t size, const void *data) {
-    glBufferData(static_cast<GLenum>(b.get_target()), size, data, GL_STATIC_DRAW);
+void gl_impl_t::buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) {
+    glBufferData(static_cast<GLenum>(b.get_target()), size, data, static_cast<GLenum>(usage));
+}
+
+void gl_impl_t::buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) {
+    glBufferSubData(static_cast<GLenum>(b.get_target()), offset, size, data);
+}
+
+void gl_impl_t::buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) {
+    glBufferStorage(static_cast<GLenum>(b.get_target()), size, data, static_cast<GLbitfield>(flags));
 }
 
 void gl_impl_t::clear() {
@@ -55,11 +111,11 @@ identifier_t<identifier_type_t::shader> gl_impl_t::new_shader(shader_type_t type
 }
 
 void gl_impl_t::destroy(size_t n, const identifier_t<identifier_type_t::buffer> *buffers) {
-    std::vector<unsigned> to_delete(n);
-    for (int i = 0; i < n; i++) {
-        to_delete[i] = buffers[i].get_id();
-    }
-    glDeleteBuffers(n, to_delete.data());
+    delete_names(n, buffers, glDeleteBuffers);
+}
+
+void gl_impl_t::destroy(sync_t sync) {
+    glDeleteSync(sync);
 }
 
 void gl_impl_t::destroy(const id_program_t &program) {
@@ -71,31 +127,51 @@ void gl_impl_t::destroy(const id_shader_t &shader) {
 }
 
 void gl_impl_t::destroy(size_t n, const id_texture_t *textures) {
-    std::vector<unsigned> to_delete(n);
-    for (int i = 0; i < n; i++) {
-        to_delete[i] = textures[i].get_id();
-    }
-    glDeleteTextures(n, to_delete.data());
+    delete_names(n, textures, glDeleteTextures);
 }
 
 void gl_impl_t::destroy(size_t n, const id_vertex_array_t *arrays) {
-    std::vector<unsigned> to_delete(n);
-    for (int i = 0; i < n; i++) {
-        to_delete[i] = arrays[i].get_id();
-    }
-    glDeleteVertexArrays(n, to_delete.data());
+    delete_names(n, arrays, glDeleteVertexArrays);
+}
+
+void gl_impl_t::destroy(size_t n, const id_query_t *queries) {
+    delete_names(n, queries, glDeleteQueries);
 }
 
 void gl_impl_t::disable(graphics_feature_t cap) {
     glDisable(static_cast<GLenum>(cap));
 }
 
+sync_t gl_impl_t::fence_sync() {
+    return glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+sync_status_t gl_impl_t::client_wait_sync(sync_t sync, uint64_t timeout) {
+    return static_cast<sync_status_t>(glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout));
+}
+
 void gl_impl_t::draw_arrays(int first, size_t count) {
     glDrawArrays(GL_TRIANGLES, first, count);
 }
 
-void gl_impl_t::draw_elements(const std::vector<unsigned> &indices) {
-    glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, nullptr);
+void gl_impl_t::draw_arrays_instanced(int first, size_t count, size_t instances) {
+    glDrawArraysInstanced(GL_TRIANGLES, first, count, instances);
+}
+
+void gl_impl_t::draw_elements(size_t count, index_type_t type, size_t offset) {
+    glDrawElements(GL_TRIANGLES, count, static_cast<GLenum>(type), buffer_offset(offset));
+}
+
+void gl_impl_t::draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) {
+    glDrawElementsInstanced(GL_TRIANGLES, count, static_cast<GLenum>(type), buffer_offset(offset), instances);
+}
+
+void gl_impl_t::multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) {
+    glMultiDrawArraysIndirect(GL_TRIANGLES, buffer_offset(offset), draw_count, stride);
+}
+
+void gl_impl_t::multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) {
+    glMultiDrawElementsIndirect(GL_TRIANGLES, static_cast<GLenum>(type), buffer_offset(offset), draw_count, stride);
 }
 
 void gl_impl_t::enable(graphics_feature_t cap) {
@@ -142,10 +218,35 @@ std::vector<id_vertex_array_t> gl_impl_t::new_vertex_arrays(size_t n) {
     return ret;
 }
 
+std::vector<id_query_t> gl_impl_t::new_queries(size_t n) {
+    std::vector<GLuint> ids(n);
+    glGenQueries(n, ids.data());
+
+    std::vector<id_query_t> ret;
+    ret.reserve(n);
+    for (const auto to_ret : ids) {
+        ret.emplace_back(to_ret);
+    }
+    return ret;
+}
+
 void gl_impl_t::generate_mipmap(const texture_t &t) {
     glGenerateMipmap(static_cast<GLenum>(t.get_target()));
 }
 
+std::string gl_impl_t::get_active_uniform(const program_t &p, unsigned index) {
+    GLint max_name_len = 0;
+    glGetProgramiv(p.get_id(), GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_len);
+
+    std::string name(max_name_len, '\0');
+    GLsizei name_len = 0;
+    GLint size = 0;
+    GLenum type = 0;
+    glGetActiveUniform(p.get_id(), index, max_name_len, &name_len, &size, &type, name.data());
+    name.resize(name_len);
+    return name;
+}
+
 std::string gl_impl_t::get_info_log(const program_t &p) {
     GLint info_log_len = 0;
     glGetProgramiv(p.get_id(), GL_INFO_LOG_LENGTH, &info_log_len);
@@ -162,6 +263,23 @@ int gl_impl_t::get_parameter(const program_t &p, program_parameter_t param) {
     return ret;
 }
 
+program_binary_t gl_impl_t::get_program_binary(const program_t &p) {
+    GLint length = 0;
+    glGetProgramiv(p.get_id(), GL_PROGRAM_BINARY_LENGTH, &length);
+
+    program_binary_t ret{0, std::vector<std::byte>(length)};
+    GLenum format = 0;
+    glGetProgramBinary(p.get_id(), length, &length, &format, ret.m_data.data());
+    ret.m_data.resize(length);
+    ret.m_format = format;
+    return ret;
+}
+
+std::string gl_impl_t::get_string(string_name_t name) {
+    const auto *str = glGetString(static_cast<GLenum>(name));
+    return str != nullptr ? reinterpret_cast<const char *>(str) : ""; // NOLINT(*-reinterpret-cast)
+}
+
 std::string gl_impl_t::get_info_log(const shader_t &s) {
     GLint info_log_len = 0;
     glGetShaderiv(s.get_id(), GL_INFO_LOG_LENGTH, &info_log_len);
@@ -172,6 +290,18 @@ std::string gl_impl_t::get_info_log(const shader_t &s) {
     return info_log;
 }
 
+uint64_t gl_impl_t::get_query_result(const id_query_t &q) {
+    GLuint64 result = 0;
+    glGetQueryObjectui64v(q.get_id(), GL_QUERY_RESULT, &result);
+    return result;
+}
+
+int64_t gl_impl_t::get_timestamp() {
+    GLint64 timestamp = 0;
+    glGetInteger64v(GL_TIMESTAMP, &timestamp);
+    return timestamp;
+}
+
 int gl_impl_t::get_parameter(const shader_t &s, shader_parameter_t param) {
     int ret = 0;
     glGetShaderiv(s.get_id(), static_cast<GLenum>(param), &ret);
@@ -182,25 +312,88 @@ int gl_impl_t::get_uniform_location(const program_t &p, const char *name) {
     return glGetUniformLocation(p.get_id(), name);
 }
 
+bool gl_impl_t::has_extension(extension_t ext) {
+    switch (ext) {
+    case extension_t::base_instance:
+        return GLAD_GL_ARB_base_instance != 0;
+    case extension_t::buffer_storage:
+        return GLAD_GL_ARB_buffer_storage != 0;
+    case extension_t::get_program_binary:
+        return GLAD_GL_ARB_get_program_binary != 0;
+    case extension_t::multi_draw_indirect:
+        return GLAD_GL_ARB_draw_indirect != 0 && GLAD_GL_ARB_multi_draw_indirect != 0;
+    case extension_t::parallel_shader_compile:
+        return GLAD_GL_KHR_parallel_shader_compile != 0;
+    case extension_t::texture_compression_bptc:
+        return GLAD_GL_ARB_texture_compression_bptc != 0;
+    case extension_t::texture_compression_etc2:
+        return GLAD_GL_ARB_ES3_compatibility != 0;
+    case extension_t::texture_compression_s3tc:
+        return GLAD_GL_EXT_texture_compression_s3tc != 0;
+    case extension_t::texture_storage:
+        return GLAD_GL_ARB_texture_storage != 0;
+    }
+    return false;
+}
+
+bool gl_impl_t::is_query_result_available(const id_query_t &q) {
+    GLint available = GL_FALSE;
+    glGetQueryObjectiv(q.get_id(), GL_QUERY_RESULT_AVAILABLE, &available);
+    return available != GL_FALSE;
+}
+
 error_t gl_impl_t::link(const program_t &p) {
     glLinkProgram(p.get_id());
     return static_cast<error_t>(glGetError());
 }
 
+void *gl_impl_t::map_buffer_range(const buffer_t &b, size_t offset, size_t length, buffer_access_t access) {
+    return glMapBufferRange(static_cast<GLenum>(b.get_target()), offset, length, static_cast<GLbitfield>(access));
+}
+
+void gl_impl_t::max_shader_compiler_threads(unsigned count) {
+    // glad leaves the entry point null when the context lacks the extension.
+    if (GLAD_GL_KHR_parallel_shader_compile != 0) {
+        glMaxShaderCompilerThreadsKHR(count);
+    }
+}
+
 void gl_impl_t::polygon_mode(polygon_mode_t mode) {
     glPolygonMode(GL_FRONT_AND_BACK, static_cast<GLenum>(mode));
 }
 
-void gl_impl_t::set_sources(const shader_t &s, size_t num_sources, const char **sources) {
-    glShaderSource(s.get_id(), num_sources, sources, nullptr);
+void gl_impl_t::query_counter(const id_query_t &q) {
+    glQueryCounter(q.get_id(), GL_TIMESTAMP);
+}
+
+void gl_impl_t::set_sources(const shader_t &s, size_t num_sources, const char **sources, const int *lengths) {
+    glShaderSource(s.get_id(), num_sources, sources, lengths);
+}
+
+void gl_impl_t::set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                          const unsigned char *data) {
+    // The base internal format matching the pixel format, so RGBA data keeps its alpha channel.
+    glTexImage2D(static_cast<GLenum>(t.get_target()), 0, static_cast<GLint>(format), width, height, 0,
+                 static_cast<GLenum>(format), GL_UNSIGNED_BYTE, data);
+}
+
+void gl_impl_t::set_parameter(const texture_t &t, texture_parameter_t name, texture_parameter_values_t value) {
+    glTexParameteri(static_cast<GLenum>(t.get_target()), static_cast<GLenum>(name), static_cast<GLint>(value));
 }
 
-void gl_impl_t::set_image(size_t width, size_t height, texture_format_t format, const unsigned char *data) {
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, static_cast<GLenum>(format), GL_UNSIGNED_BYTE, data);
+void gl_impl_t::set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                              texture_format_t format, pixel_type_t type, const void *data) {
+    glTexSubImage2D(static_cast<GLenum>(t.get_target()), level, static_cast<GLint>(x), static_cast<GLint>(y),
+                    static_cast<GLsizei>(width), static_cast<GLsizei>(height), static_cast<GLenum>(format),
+                    static_cast<GLenum>(type), data);
 }
 
-void gl_impl_t::set_parameter(texture_parameter_t name, texture_parameter_values_t value) {
-    glTexParameteri(GL_TEXTURE_2D, static_cast<GLenum>(name), static_cast<GLint>(value));
+void gl_impl_t::set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width,
+                                 size_t height, size_t depth, texture_format_t format, pixel_type_t type,
+                                 const void *data) {
+    glTexSubImage3D(static_cast<GLenum>(t.get_target()), level, static_cast<GLint>(x), static_cast<GLint>(y),
+                    static_cast<GLint>(z), static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                    static_cast<GLsizei>(depth), static_cast<GLenum>(format), static_cast<GLenum>(type), data);
 }
 
 void gl_impl_t::set_uniform(int location, float v0) {
@@ -227,6 +420,94 @@ void gl_impl_t::set_uniform(int location, const glm::mat4 &value) {
     glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
 }
 
+bool gl_impl_t::unmap_buffer(const buffer_t &b) {
+    return glUnmapBuffer(static_cast<GLenum>(b.get_target())) == GL_TRUE;
+}
+
+void gl_impl_t::texture_storage(const texture_t &t, size_t levels, texture_internal_format_t format, size_t width,
+                                size_t height) {
+    const auto target = static_cast<GLenum>(t.get_target());
+    if (GLAD_GL_ARB_texture_storage != 0) {
+        glTexStorage2D(target, static_cast<GLsizei>(levels), static_cast<GLenum>(format), static_cast<GLsizei>(width),
+                       static_cast<GLsizei>(height));
+        return;
+    }
+
+    const auto [upload_format, upload_type] = storage_upload_format(format);
+    for (size_t level = 0; level < levels; ++level) {
+        const auto level_width = std::max<size_t>(1, width >> level);
+        const auto level_height = std::max<size_t>(1, height >> level);
+        if (texture_t::is_compressed(format)) {
+            // Compressed formats are only reliably accepted by the compressed variant, along with their size.
+            const auto size = texture_t::get_compressed_size(format, level_width, level_height);
+            glCompressedTexImage2D(target, static_cast<GLint>(level), static_cast<GLenum>(format),
+                                   static_cast<GLsizei>(level_width), static_cast<GLsizei>(level_height), 0,
+                                   static_cast<GLsizei>(size), nullptr);
+        } else {
+            glTexImage2D(target, static_cast<GLint>(level), static_cast<GLint>(format),
+                         static_cast<GLsizei>(level_width), static_cast<GLsizei>(level_height), 0, upload_format,
+                         upload_type, nullptr);
+        }
+    }
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels - 1));
+}
+
+void gl_impl_t::compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width,
+                                 size_t height, size_t size, const void *data) {
+    glCompressedTexImage2D(static_cast<GLenum>(t.get_target()), level, static_cast<GLenum>(format),
+                           static_cast<GLsizei>(width), static_cast<GLsizei>(height), 0, static_cast<GLsizei>(size),
+                           data);
+}
+
+void gl_impl_t::compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                                     texture_internal_format_t format, size_t size, const void *data) {
+    glCompressedTexSubImage2D(static_cast<GLenum>(t.get_target()), level, static_cast<GLint>(x),
+                              static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height),
+                              static_cast<GLenum>(format), static_cast<GLsizei>(size), data);
+}
+
+void gl_impl_t::texture_storage_3d(const texture_t &t, size_t levels, texture_internal_format_t format, size_t width,
+                                   size_t height, size_t depth) {
+    const auto target = static_cast<GLenum>(t.get_target());
+    if (GLAD_GL_ARB_texture_storage != 0) {
+        glTexStorage3D(target, static_cast<GLsizei>(levels), static_cast<GLenum>(format), static_cast<GLsizei>(width),
+                       static_cast<GLsizei>(height), static_cast<GLsizei>(depth));
+        return;
+    }
+
+    // Array layers are not reduced along the mipmap chain, only the width and the height.
+    const auto [upload_format, upload_type] = storage_upload_format(format);
+    for (size_t level = 0; level < levels; ++level) {
+        const auto level_width = std::max<size_t>(1, width >> level);
+        const auto level_height = std::max<size_t>(1, height >> level);
+        if (texture_t::is_compressed(format)) {
+            // Compressed formats are only reliably accepted by the compressed variant, along with their size.
+            const auto size = texture_t::get_compressed_size(format, level_width, level_height) * depth;
+            glCompressedTexImage3D(target, static_cast<GLint>(level), static_cast<GLenum>(format),
+                                   static_cast<GLsizei>(level_width), static_cast<GLsizei>(level_height),
+                                   static_cast<GLsizei>(depth), 0, static_cast<GLsizei>(size), nullptr);
+        } else {
+            glTexImage3D(target, static_cast<GLint>(level), static_cast<GLint>(format),
+                         static_cast<GLsizei>(level_width), static_cast<GLsizei>(level_height),
+                         static_cast<GLsizei>(depth), 0, upload_format, upload_type, nullptr);
+        }
+    }
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels - 1));
+}
+
+void gl_impl_t::unbind(buffer_target_t target) {
+    glBindBuffer(static_cast<GLenum>(target), 0);
+}
+
+error_t gl_impl_t::program_binary(const program_t &p, const program_binary_t &binary) {
+    glProgramBinary(p.get_id(), binary.m_format, binary.m_data.data(), static_cast<GLsizei>(binary.m_data.size()));
+    return static_cast<error_t>(glGetError());
+}
+
+void gl_impl_t::set_parameter(const program_t &p, program_parameter_t param, int value) {
+    glProgramParameteri(p.get_id(), static_cast<GLenum>(param), value);
+}
+
 void gl_impl_t::use(const program_t &p) {
     glUseProgram(p.get_id());
 }
@@ -235,6 +516,16 @@ void gl_impl_t::vertex_attrib_pointer(unsigned index, size_t size, size_t stride
     glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void *>(offset));
 }
 
+void gl_impl_t::vertex_attrib_pointer(unsigned index, size_t size, vertex_attrib_type_t type, bool normalized,
+                                      size_t stride, unsigned offset) {
+    glVertexAttribPointer(index, size, static_cast<GLenum>(type), normalized ? GL_TRUE : GL_FALSE, stride,
+                          reinterpret_cast<const void *>(offset));
+}
+
+void gl_impl_t::vertex_attrib_divisor(unsigned index, unsigned divisor) {
+    glVertexAttribDivisor(index, divisor);
+}
+
 void gl_impl_t::set_viewport(size_t width, size_t height) {
     glViewport(0, 0, width, height);
 }
@@ -0,0 +1,87 @@
+#include "opengl-cpp/backend/gl_name_pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace {
+
+template <class id_t, class generate_t>
+std::vector<id_t> take(std::vector<id_t> &free, size_t n, size_t batch_size, generate_t generate) {
+    if (free.size() < n) {
+        for (const auto &id : generate(std::max(batch_size, n - free.size()))) {
+            free.push_back(id);
+        }
+    }
+
+    const auto first = free.end() - static_cast<std::ptrdiff_t>(n);
+    std::vector<id_t> ret(first, free.end());
+    free.erase(first, free.end());
+    return ret;
+}
+
+template <class id_t> void release(std::vector<id_t> &released, size_t n, const id_t *ids) {
+    for (size_t i = 0; i < n; ++i) {
+        if (ids[i]) {
+            released.push_back(ids[i]);
+        }
+    }
+}
+
+template <class id_t> void destroy_all(opengl_cpp::gl_t &gl, std::vector<id_t> &ids) {
+    if (!ids.empty()) {
+        gl.destroy(ids.size(), ids.data());
+        ids.clear();
+    }
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+gl_name_pool_t::gl_name_pool_t(gl_t &gl, size_t batch_size) : gl_decorator_t(gl), m_batch_size(batch_size) {
+    assert(batch_size > 0);
+}
+
+gl_name_pool_t::~gl_name_pool_t() {
+    flush();
+    destroy_all(m_gl, m_free_buffers);
+    destroy_all(m_gl, m_free_textures);
+    destroy_all(m_gl, m_free_vertex_arrays);
+}
+
+void gl_name_pool_t::flush() {
+    destroy_all(m_gl, m_released_buffers);
+    destroy_all(m_gl, m_released_textures);
+    destroy_all(m_gl, m_released_vertex_arrays);
+}
+
+size_t gl_name_pool_t::get_released() const {
+    return m_released_buffers.size() + m_released_textures.size() + m_released_vertex_arrays.size();
+}
+
+std::vector<id_buffer_t> gl_name_pool_t::new_buffers(size_t n) {
+    return take(m_free_buffers, n, m_batch_size, [this](size_t amount) { return m_gl.new_buffers(amount); });
+}
+
+std::vector<id_texture_t> gl_name_pool_t::new_textures(size_t n) {
+    return take(m_free_textures, n, m_batch_size, [this](size_t amount) { return m_gl.new_textures(amount); });
+}
+
+std::vector<id_vertex_array_t> gl_name_pool_t::new_vertex_arrays(size_t n) {
+    return take(m_free_vertex_arrays, n, m_batch_size,
+                [this](size_t amount) { return m_gl.new_vertex_arrays(amount); });
+}
+
+void gl_name_pool_t::destroy(size_t n, const id_buffer_t *buffers) {
+    release(m_released_buffers, n, buffers);
+}
+
+void gl_name_pool_t::destroy(size_t n, const id_texture_t *textures) {
+    release(m_released_textures, n, textures);
+}
+
+void gl_name_pool_t::destroy(size_t n, const id_vertex_array_t *arrays) {
+    release(m_released_vertex_arrays, n, arrays);
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,271 @@
+#include "opengl-cpp/backend/gl_profiler.h"
+
+#include <array>
+#include <cassert>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace {
+
+constexpr int trace_pid = 1;
+constexpr int cpu_tid = 1;
+constexpr int gpu_tid = 2;
+
+void write_string(std::ostream &os, const std::string &s) {
+    os << '"';
+    for (const auto c : s) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            const std::array<char, 16> digits = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                                 '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+            os << "\\u00" << digits[static_cast<size_t>(c) >> 4] << digits[static_cast<size_t>(c) & 0xF];
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+// Trace times are in microseconds, nanoseconds being kept as decimals.
+void write_time(std::ostream &os, int64_t ns) {
+    os << std::fixed << std::setprecision(3) << static_cast<double>(ns) / 1000.0;
+}
+
+void write_thread_name(std::ostream &os, int tid, const char *name) {
+    os << R"({"name":"thread_name","ph":"M","pid":)" << trace_pid << R"(,"tid":)" << tid
+       << R"(,"args":{"name":")" << name << R"("}})";
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+gl_profiler_t::scope_t::scope_t(gl_profiler_t &profiler, std::string name) : m_profiler(profiler) {
+    m_profiler.begin_scope(std::move(name));
+}
+
+gl_profiler_t::scope_t::~scope_t() {
+    m_profiler.end_scope();
+}
+
+gl_profiler_t::gl_profiler_t(gl_t &gl, size_t query_capacity)
+    : gl_decorator_t(gl), m_epoch(std::chrono::steady_clock::now()), m_queries(gl.new_queries(query_capacity)),
+      m_gpu_scopes(query_capacity / 2) {
+    assert(query_capacity >= 2);
+    synchronize_clocks();
+}
+
+gl_profiler_t::~gl_profiler_t() {
+    m_gl.destroy(m_queries.size(), m_queries.data());
+}
+
+void gl_profiler_t::begin_scope(std::string name) {
+    if (m_next_pair - m_oldest_pair == m_gpu_scopes.size()) {
+        collect();
+    }
+
+    std::optional<uint64_t> pair;
+    if (m_next_pair - m_oldest_pair < m_gpu_scopes.size()) {
+        pair = m_next_pair++;
+        const auto slot = *pair % m_gpu_scopes.size();
+        m_gpu_scopes[slot] = {name, m_open_scopes.size(), false, {}};
+        m_gl.query_counter(m_queries[slot * 2]);
+    } else {
+        ++m_dropped;
+    }
+
+    m_open_scopes.push_back({std::move(name), now(), {}, pair});
+}
+
+void gl_profiler_t::end_scope() {
+    assert(!m_open_scopes.empty());
+    auto scope = std::move(m_open_scopes.back());
+    m_open_scopes.pop_back();
+
+    if (scope.m_query_pair) {
+        const auto slot = *scope.m_query_pair % m_gpu_scopes.size();
+        m_gl.query_counter(m_queries[slot * 2 + 1]);
+        m_gpu_scopes[slot].m_closed = true;
+        m_gpu_scopes[slot].m_counters = scope.m_counters;
+    }
+
+    const auto &counters = scope.m_counters;
+    const auto start = scope.m_start;
+    m_events.push_back({std::move(scope.m_name), track_t::cpu, start, now() - start, m_open_scopes.size(),
+                        counters.m_draws, counters.m_uploads, counters.m_upload_bytes});
+}
+
+void gl_profiler_t::collect() {
+    // Queries complete in the order they were issued, so the oldest scope is the first one to become available.
+    while (m_oldest_pair < m_next_pair) {
+        const auto slot = m_oldest_pair % m_gpu_scopes.size();
+        auto &scope = m_gpu_scopes[slot];
+        const auto &begin = m_queries[slot * 2];
+        const auto &end = m_queries[slot * 2 + 1];
+        if (!scope.m_closed || !m_gl.is_query_result_available(end) || !m_gl.is_query_result_available(begin)) {
+            break;
+        }
+
+        const auto start = static_cast<int64_t>(m_gl.get_query_result(begin));
+        const auto stop = static_cast<int64_t>(m_gl.get_query_result(end));
+        const auto &counters = scope.m_counters;
+        m_events.push_back({std::move(scope.m_name), track_t::gpu, start + m_gpu_offset, stop - start, scope.m_depth,
+                            counters.m_draws, counters.m_uploads, counters.m_upload_bytes});
+        ++m_oldest_pair;
+    }
+}
+
+void gl_profiler_t::synchronize_clocks() {
+    m_gpu_offset = now() - m_gl.get_timestamp();
+}
+
+void gl_profiler_t::clear() {
+    m_events.clear();
+}
+
+const std::vector<gl_profiler_t::event_t> &gl_profiler_t::get_events() const {
+    return m_events;
+}
+
+size_t gl_profiler_t::get_pending() const {
+    return m_next_pair - m_oldest_pair;
+}
+
+size_t gl_profiler_t::get_dropped() const {
+    return m_dropped;
+}
+
+void gl_profiler_t::write_trace(std::ostream &os) const {
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << R"({"displayTimeUnit":"ms","traceEvents":[)" << '\n';
+    os << R"({"name":"process_name","ph":"M","pid":)" << trace_pid << R"(,"args":{"name":"opengl-cpp"}},)" << '\n';
+    write_thread_name(os, cpu_tid, "CPU");
+    os << ",\n";
+    write_thread_name(os, gpu_tid, "GPU");
+    for (const auto &event : m_events) {
+        os << ",\n{\"name\":";
+        write_string(os, event.m_name);
+        os << R"(,"ph":"X","pid":)" << trace_pid << R"(,"tid":)" << (event.m_track == track_t::cpu ? cpu_tid : gpu_tid)
+           << R"(,"ts":)";
+        write_time(os, event.m_start);
+        os << R"(,"dur":)";
+        write_time(os, event.m_duration);
+        os << R"(,"args":{"draws":)" << event.m_draws << R"(,"uploads":)" << event.m_uploads << R"(,"upload_bytes":)"
+           << event.m_upload_bytes << "}}";
+    }
+    os << "\n]}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void gl_profiler_t::write_trace(const std::filesystem::path &path) const {
+    std::ofstream file(path, std::ios::trunc);
+    write_trace(file);
+    if (!file) {
+        throw std::runtime_error("cannot write trace file: " + path.string());
+    }
+}
+
+void gl_profiler_t::buffer_data(const buffer_t &b, size_t size, const void *data, buffer_usage_t usage) {
+    count_upload(data != nullptr ? size : 0);
+    m_gl.buffer_data(b, size, data, usage);
+}
+
+void gl_profiler_t::buffer_sub_data(const buffer_t &b, size_t offset, size_t size, const void *data) {
+    count_upload(size);
+    m_gl.buffer_sub_data(b, offset, size, data);
+}
+
+void gl_profiler_t::buffer_storage(const buffer_t &b, size_t size, const void *data, buffer_access_t flags) {
+    count_upload(data != nullptr ? size : 0);
+    m_gl.buffer_storage(b, size, data, flags);
+}
+
+void gl_profiler_t::compressed_image(const texture_t &t, int level, texture_internal_format_t format, size_t width,
+                                     size_t height, size_t size, const void *data) {
+    count_upload(size);
+    m_gl.compressed_image(t, level, format, width, height, size, data);
+}
+
+void gl_profiler_t::compressed_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width,
+                                         size_t height, texture_internal_format_t format, size_t size,
+                                         const void *data) {
+    count_upload(size);
+    m_gl.compressed_sub_image(t, level, x, y, width, height, format, size, data);
+}
+
+void gl_profiler_t::set_image(const texture_t &t, size_t width, size_t height, texture_format_t format,
+                              const unsigned char *data) {
+    count_upload(data != nullptr ? width * height * get_pixel_size(format, pixel_type_t::unsigned_byte) : 0);
+    m_gl.set_image(t, width, height, format, data);
+}
+
+void gl_profiler_t::set_sub_image(const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                                  texture_format_t format, pixel_type_t type, const void *data) {
+    count_upload(width * height * get_pixel_size(format, type));
+    m_gl.set_sub_image(t, level, x, y, width, height, format, type, data);
+}
+
+void gl_profiler_t::set_sub_image_3d(const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width,
+                                     size_t height, size_t depth, texture_format_t format, pixel_type_t type,
+                                     const void *data) {
+    count_upload(width * height * depth * get_pixel_size(format, type));
+    m_gl.set_sub_image_3d(t, level, x, y, z, width, height, depth, format, type, data);
+}
+
+void gl_profiler_t::draw_arrays(int first, size_t count) {
+    count_draw();
+    m_gl.draw_arrays(first, count);
+}
+
+void gl_profiler_t::draw_arrays_instanced(int first, size_t count, size_t instances) {
+    count_draw();
+    m_gl.draw_arrays_instanced(first, count, instances);
+}
+
+void gl_profiler_t::draw_elements(size_t count, index_type_t type, size_t offset) {
+    count_draw();
+    m_gl.draw_elements(count, type, offset);
+}
+
+void gl_profiler_t::draw_elements_instanced(size_t count, index_type_t type, size_t offset, size_t instances) {
+    count_draw();
+    m_gl.draw_elements_instanced(count, type, offset, instances);
+}
+
+void gl_profiler_t::multi_draw_arrays_indirect(size_t offset, size_t draw_count, size_t stride) {
+    count_draw();
+    m_gl.multi_draw_arrays_indirect(offset, draw_count, stride);
+}
+
+void gl_profiler_t::multi_draw_elements_indirect(index_type_t type, size_t offset, size_t draw_count, size_t stride) {
+    count_draw();
+    m_gl.multi_draw_elements_indirect(type, offset, draw_count, stride);
+}
+
+int64_t gl_profiler_t::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count();
+}
+
+void gl_profiler_t::count_draw() {
+    for (auto &scope : m_open_scopes) {
+        ++scope.m_counters.m_draws;
+    }
+}
+
+void gl_profiler_t::count_upload(size_t bytes) {
+    for (auto &scope : m_open_scopes) {
+        ++scope.m_counters.m_uploads;
+        scope.m_counters.m_upload_bytes += bytes;
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const gl_profiler_t &p) {
+    return os << "gl_profiler(" << &p << ") events=" << p.get_events().size() << ", pending=" << p.get_pending()
+              << ", dropped=" << p.get_dropped();
+}
+
+} // namespace opengl_cpp
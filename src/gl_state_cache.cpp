@@ -0,0 +1,121 @@
+#include "opengl-cpp/backend/gl_state_cache.h"
+
+#include "buffer.h"
+#include "program.h"
+#include "texture.h"
+#include "vertex_array.h"
+
+namespace opengl_cpp {
+
+gl_state_cache_t::gl_state_cache_t(gl_t &gl) : gl_decorator_t(gl) {
+}
+
+void gl_state_cache_t::invalidate() {
+    m_program.reset();
+    m_vertex_array.reset();
+    m_active_unit.reset();
+    m_buffers.clear();
+    m_textures.clear();
+}
+
+void gl_state_cache_t::destroy(size_t n, const id_buffer_t *buffers) {
+    // Deleting a bound buffer reverts its binding to zero. Forget it so a new buffer reusing the name gets bound.
+    for (size_t i = 0; i < n; ++i) {
+        for (auto it = m_buffers.begin(); it != m_buffers.end();) {
+            it = it->second == buffers[i].get_id() ? m_buffers.erase(it) : std::next(it);
+        }
+    }
+    m_gl.destroy(n, buffers);
+}
+
+void gl_state_cache_t::destroy(const id_program_t &program) {
+    if (m_program == program.get_id()) {
+        m_program.reset();
+    }
+    m_gl.destroy(program);
+}
+
+void gl_state_cache_t::destroy(size_t n, const id_texture_t *textures) {
+    for (size_t i = 0; i < n; ++i) {
+        for (auto it = m_textures.begin(); it != m_textures.end();) {
+            it = it->second == textures[i].get_id() ? m_textures.erase(it) : std::next(it);
+        }
+    }
+    m_gl.destroy(n, textures);
+}
+
+void gl_state_cache_t::destroy(size_t n, const id_vertex_array_t *arrays) {
+    for (size_t i = 0; i < n; ++i) {
+        if (m_vertex_array == arrays[i].get_id()) {
+            m_vertex_array.reset();
+            m_buffers.erase(buffer_target_t::element_array);
+        }
+    }
+    m_gl.destroy(n, arrays);
+}
+
+void gl_state_cache_t::activate(const texture_t &tex) {
+    if (m_active_unit == tex.get_unit()) {
+        return;
+    }
+    m_gl.activate(tex);
+    m_active_unit = tex.get_unit();
+}
+
+void gl_state_cache_t::bind(const texture_t &t) {
+    if (!m_active_unit) {
+        m_gl.bind(t);
+        return;
+    }
+
+    const auto key = texture_key(*m_active_unit, t.get_target());
+    const auto it = m_textures.find(key);
+    if (it != m_textures.end() && it->second == t.get_id().get_id()) {
+        return;
+    }
+    m_gl.bind(t);
+    m_textures[key] = t.get_id();
+}
+
+void gl_state_cache_t::use(const program_t &p) {
+    if (m_program == p.get_id().get_id()) {
+        return;
+    }
+    m_gl.use(p);
+    m_program = p.get_id();
+}
+
+void gl_state_cache_t::bind(const buffer_t &b) {
+    const auto it = m_buffers.find(b.get_target());
+    if (it != m_buffers.end() && it->second == b.get_id().get_id()) {
+        return;
+    }
+    m_gl.bind(b);
+    m_buffers[b.get_target()] = b.get_id();
+}
+
+void gl_state_cache_t::unbind(buffer_target_t target) {
+    const auto it = m_buffers.find(target);
+    if (it != m_buffers.end() && it->second == 0) {
+        return;
+    }
+    m_gl.unbind(target);
+    m_buffers[target] = 0;
+}
+
+void gl_state_cache_t::bind(const vertex_array_t &va) {
+    if (m_vertex_array == va.get_id().get_id()) {
+        return;
+    }
+    m_gl.bind(va);
+    m_vertex_array = va.get_id();
+
+    // The element array binding is part of the vertex array state.
+    m_buffers.erase(buffer_target_t::element_array);
+}
+
+uint64_t gl_state_cache_t::texture_key(int unit, texture_target_t target) {
+    return (static_cast<uint64_t>(unit) << 32U) | static_cast<uint32_t>(target);
+}
+
+} // namespace opengl_cpp
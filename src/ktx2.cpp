@@ -0,0 +1,297 @@
+#include "ktx2.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+using opengl_cpp::extension_t;
+using opengl_cpp::pixel_type_t;
+using opengl_cpp::texture_format_t;
+using opengl_cpp::texture_internal_format_t;
+
+constexpr std::array<unsigned char, 12> identifier = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr size_t header_size = 80;
+constexpr size_t level_index_entry_size = 24;
+constexpr size_t row_alignment = 4;
+
+// Byte offsets of the header fields used.
+constexpr size_t vk_format_offset = 12;
+constexpr size_t width_offset = 20;
+constexpr size_t height_offset = 24;
+constexpr size_t depth_offset = 28;
+constexpr size_t layer_count_offset = 32;
+constexpr size_t face_count_offset = 36;
+constexpr size_t level_count_offset = 40;
+constexpr size_t supercompression_offset = 44;
+
+// Pixel data layout of the uncompressed formats.
+struct pixel_layout_t {
+    texture_format_t m_format;
+    pixel_type_t m_type;
+    size_t m_texel_size;
+};
+
+template <class type_t> type_t read(std::string_view data, size_t offset) {
+    type_t value{};
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+std::optional<texture_internal_format_t> from_vk_format(uint32_t vk_format) {
+    switch (vk_format) {
+    case 9: // VK_FORMAT_R8_UNORM
+        return texture_internal_format_t::r8;
+    case 16: // VK_FORMAT_R8G8_UNORM
+        return texture_internal_format_t::rg8;
+    case 23: // VK_FORMAT_R8G8B8_UNORM
+        return texture_internal_format_t::rgb8;
+    case 29: // VK_FORMAT_R8G8B8_SRGB
+        return texture_internal_format_t::srgb8;
+    case 37: // VK_FORMAT_R8G8B8A8_UNORM
+        return texture_internal_format_t::rgba8;
+    case 43: // VK_FORMAT_R8G8B8A8_SRGB
+        return texture_internal_format_t::srgb8_alpha8;
+    case 76: // VK_FORMAT_R16_SFLOAT
+        return texture_internal_format_t::r16f;
+    case 83: // VK_FORMAT_R16G16_SFLOAT
+        return texture_internal_format_t::rg16f;
+    case 97: // VK_FORMAT_R16G16B16A16_SFLOAT
+        return texture_internal_format_t::rgba16f;
+    case 100: // VK_FORMAT_R32_SFLOAT
+        return texture_internal_format_t::r32f;
+    case 103: // VK_FORMAT_R32G32_SFLOAT
+        return texture_internal_format_t::rg32f;
+    case 109: // VK_FORMAT_R32G32B32A32_SFLOAT
+        return texture_internal_format_t::rgba32f;
+    case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        return texture_internal_format_t::bc1_rgb;
+    case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        return texture_internal_format_t::bc1_rgba;
+    case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+        return texture_internal_format_t::bc3_rgba;
+    case 139: // VK_FORMAT_BC4_UNORM_BLOCK
+        return texture_internal_format_t::bc4_r;
+    case 141: // VK_FORMAT_BC5_UNORM_BLOCK
+        return texture_internal_format_t::bc5_rg;
+    case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+        return texture_internal_format_t::bc7_rgba;
+    case 146: // VK_FORMAT_BC7_SRGB_BLOCK
+        return texture_internal_format_t::bc7_srgb_alpha;
+    case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        return texture_internal_format_t::etc2_rgb8;
+    case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+        return texture_internal_format_t::etc2_srgb8;
+    case 151: // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+        return texture_internal_format_t::etc2_rgba8;
+    case 152: // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+        return texture_internal_format_t::etc2_srgb8_alpha8;
+    default:
+        return std::nullopt;
+    }
+}
+
+pixel_layout_t get_pixel_layout(texture_internal_format_t format) {
+    switch (format) {
+    case texture_internal_format_t::r8:
+        return {texture_format_t::red, pixel_type_t::unsigned_byte, 1};
+    case texture_internal_format_t::rg8:
+        return {texture_format_t::rg, pixel_type_t::unsigned_byte, 2};
+    case texture_internal_format_t::rgb8:
+    case texture_internal_format_t::srgb8:
+        return {texture_format_t::rgb, pixel_type_t::unsigned_byte, 3};
+    case texture_internal_format_t::r16f:
+        return {texture_format_t::red, pixel_type_t::half_float, 2};
+    case texture_internal_format_t::rg16f:
+        return {texture_format_t::rg, pixel_type_t::half_float, 4};
+    case texture_internal_format_t::rgba16f:
+        return {texture_format_t::rgba, pixel_type_t::half_float, 8};
+    case texture_internal_format_t::r32f:
+        return {texture_format_t::red, pixel_type_t::single_float, 4};
+    case texture_internal_format_t::rg32f:
+        return {texture_format_t::rg, pixel_type_t::single_float, 8};
+    case texture_internal_format_t::rgba32f:
+        return {texture_format_t::rgba, pixel_type_t::single_float, 16};
+    default:
+        return {texture_format_t::rgba, pixel_type_t::unsigned_byte, 4};
+    }
+}
+
+std::optional<extension_t> get_required_extension(texture_internal_format_t format) {
+    switch (format) {
+    case texture_internal_format_t::bc1_rgb:
+    case texture_internal_format_t::bc1_rgba:
+    case texture_internal_format_t::bc3_rgba:
+        return extension_t::texture_compression_s3tc;
+    case texture_internal_format_t::bc7_rgba:
+    case texture_internal_format_t::bc7_srgb_alpha:
+        return extension_t::texture_compression_bptc;
+    case texture_internal_format_t::etc2_rgb8:
+    case texture_internal_format_t::etc2_srgb8:
+    case texture_internal_format_t::etc2_rgba8:
+    case texture_internal_format_t::etc2_srgb8_alpha8:
+        return extension_t::texture_compression_etc2;
+    default:
+        // BC4 and BC5 are the RGTC formats, which are core since OpenGL 3.0.
+        return std::nullopt;
+    }
+}
+
+// Multiplies without wrapping around, returning std::nullopt when the product does not fit in a size_t.
+std::optional<size_t> multiply(size_t a, size_t b) {
+    if (a != 0 && b > std::numeric_limits<size_t>::max() / a) {
+        return std::nullopt;
+    }
+    return a * b;
+}
+
+// Returns std::nullopt when the size does not fit in a size_t, as headers can ask for up to 2^32 texels per side.
+std::optional<size_t> get_level_size(texture_internal_format_t format, size_t width, size_t height) {
+    if (opengl_cpp::texture_t::is_compressed(format)) {
+        // Blocks of 4x4 texels never take more than a byte per texel of the level rounded up to whole blocks.
+        if (!multiply(width + 3, height + 3)) {
+            return std::nullopt;
+        }
+        return opengl_cpp::texture_t::get_compressed_size(format, width, height);
+    }
+
+    const auto texels = multiply(width, height);
+    return texels ? multiply(*texels, get_pixel_layout(format).m_texel_size) : std::nullopt;
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+ktx2_file_t::ktx2_file_t(const std::filesystem::path &path) : m_file(path) {
+    const auto data = m_file.get_view();
+    const auto fail = [&](const std::string &reason) {
+        return std::runtime_error("invalid KTX2 file " + path.string() + ": " + reason);
+    };
+
+    if (data.size() < header_size + level_index_entry_size ||
+        std::memcmp(data.data(), identifier.data(), identifier.size()) != 0) {
+        throw fail("bad identifier");
+    }
+
+    const auto vk_format = read<uint32_t>(data, vk_format_offset);
+    const auto format = from_vk_format(vk_format);
+    if (!format) {
+        throw fail("unsupported format " + std::to_string(vk_format));
+    }
+    if (read<uint32_t>(data, supercompression_offset) != 0) {
+        throw fail("supercompression is not supported");
+    }
+    if (read<uint32_t>(data, width_offset) == 0) {
+        throw fail("zero width");
+    }
+    if (read<uint32_t>(data, height_offset) == 0 || read<uint32_t>(data, depth_offset) != 0 ||
+        read<uint32_t>(data, layer_count_offset) != 0 || read<uint32_t>(data, face_count_offset) != 1) {
+        throw fail("only 2D textures are supported");
+    }
+
+    m_format = *format;
+    m_width = read<uint32_t>(data, width_offset);
+    m_height = read<uint32_t>(data, height_offset);
+
+    // A level count of zero asks the loader to generate the mipmaps from the only level stored.
+    auto level_count = static_cast<size_t>(read<uint32_t>(data, level_count_offset));
+    m_generate_mipmap = level_count == 0;
+    level_count = std::max<size_t>(1, level_count);
+    if (level_count > texture_t::get_full_levels(m_width, m_height) ||
+        data.size() < header_size + level_count * level_index_entry_size) {
+        throw fail("bad level count");
+    }
+
+    const auto layout = get_pixel_layout(m_format);
+    for (size_t level = 0; level < level_count; ++level) {
+        const auto entry = header_size + level * level_index_entry_size;
+        const auto offset = read<uint64_t>(data, entry);
+        const auto length = read<uint64_t>(data, entry + sizeof(uint64_t));
+
+        const auto width = std::max<size_t>(1, m_width >> level);
+        const auto height = std::max<size_t>(1, m_height >> level);
+        const auto size = get_level_size(m_format, width, height);
+        if (!size) {
+            throw fail("level " + std::to_string(level) + " is too large");
+        }
+        if (length != *size || offset > data.size() || length > data.size() - offset) {
+            throw fail("bad size or offset of level " + std::to_string(level));
+        }
+
+        // Levels are tightly packed, while uploads expect each row to start on the default unpack alignment.
+        if (!texture_t::is_compressed(m_format) && height > 1 && (width * layout.m_texel_size) % row_alignment != 0) {
+            throw fail("rows of level " + std::to_string(level) + " are not aligned to 4 bytes");
+        }
+
+        m_levels.push_back(data.substr(offset, length));
+    }
+}
+
+texture_t ktx2_file_t::load(gl_t &gl, int unit) const {
+    const auto extension = get_required_extension(m_format);
+    if (extension && !gl.has_extension(*extension)) {
+        throw std::runtime_error("compressed texture format not supported by the context: " +
+                                 std::to_string(static_cast<int>(m_format)));
+    }
+
+    // Block-compressed textures cannot have their mipmaps generated by OpenGL.
+    const auto compressed = texture_t::is_compressed(m_format);
+    const auto levels = m_generate_mipmap && !compressed ? texture_t::get_full_levels(m_width, m_height)
+                                                         : m_levels.size();
+
+    texture_t texture(gl, unit, texture_target_t::tex_2d);
+    texture.bind();
+    texture.allocate(m_width, m_height, m_format, levels);
+
+    const auto layout = get_pixel_layout(m_format);
+    for (size_t level = 0; level < m_levels.size(); ++level) {
+        const auto width = std::max<size_t>(1, m_width >> level);
+        const auto height = std::max<size_t>(1, m_height >> level);
+        const auto &data = m_levels[level];
+        if (compressed) {
+            texture.set_compressed_sub_image(static_cast<int>(level), 0, 0, width, height, data.size(), data.data());
+        } else {
+            texture.set_sub_image(static_cast<int>(level), 0, 0, width, height, layout.m_format, data.data(),
+                                  layout.m_type);
+        }
+    }
+
+    if (levels > m_levels.size()) {
+        texture.generate_mipmap();
+    }
+    return texture;
+}
+
+std::string_view ktx2_file_t::get_level_data(size_t level) const {
+    return m_levels.at(level);
+}
+
+size_t ktx2_file_t::get_width() const {
+    return m_width;
+}
+
+size_t ktx2_file_t::get_height() const {
+    return m_height;
+}
+
+size_t ktx2_file_t::get_levels() const {
+    return m_levels.size();
+}
+
+texture_internal_format_t ktx2_file_t::get_format() const {
+    return m_format;
+}
+
+std::ostream &operator<<(std::ostream &os, const ktx2_file_t &f) {
+    return os << "ktx2_file(" << &f << ") size=" << f.get_width() << "x" << f.get_height()
+              << ", levels=" << f.get_levels() << ", format=" << static_cast<int>(f.get_format());
+}
+
+} // namespace opengl_cpp
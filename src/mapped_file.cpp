@@ -0,0 +1,57 @@
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace opengl_cpp {
+
+mapped_file_t::mapped_file_t(const std::filesystem::path &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY); // NOLINT(*-vararg)
+    if (fd < 0) {
+        throw std::runtime_error("file not found: " + path.string());
+    }
+
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("cannot stat file: " + path.string());
+    }
+
+    // Empty files cannot be mapped, they are simply viewed as empty.
+    m_size = static_cast<size_t>(info.st_size);
+    if (m_size > 0) {
+        void *data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("cannot map file: " + path.string());
+        }
+        m_data = static_cast<const char *>(data);
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+}
+
+mapped_file_t::mapped_file_t(mapped_file_t &&other) noexcept : m_data(other.m_data), m_size(other.m_size) {
+    other.m_data = nullptr;
+    other.m_size = 0;
+}
+
+mapped_file_t::~mapped_file_t() {
+    if (m_data != nullptr) {
+        ::munmap(const_cast<char *>(m_data), m_size); // NOLINT(*-const-cast)
+    }
+}
+
+std::string_view mapped_file_t::get_view() const {
+    return {m_data, m_size};
+}
+
+std::ostream &operator<<(std::ostream &os, const mapped_file_t &f) {
+    return os << "mapped_file(" << &f << ") size=" << f.get_view().size();
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,324 @@
+#include "mesh_file.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+using opengl_cpp::index_type_t;
+using opengl_cpp::mesh_file_t;
+using opengl_cpp::mesh_range_t;
+using opengl_cpp::vertex_attrib_type_t;
+
+constexpr uint32_t magic = 0x4D43474F; // "OGCM" once stored little-endian.
+
+struct file_attribute_t {
+    uint32_t m_location;
+    uint32_t m_components;
+    uint32_t m_type;
+    uint32_t m_normalized;
+    uint32_t m_offset;
+};
+
+// Fixed-size header at the start of every file, followed by m_submesh_count sub-mesh ranges.
+struct file_header_t {
+    uint32_t m_magic;
+    uint32_t m_version;
+    uint32_t m_stride;
+    uint32_t m_attribute_count;
+    uint32_t m_index_type; // Zero for meshes drawn without indices.
+    uint32_t m_submesh_count;
+    uint64_t m_vertex_count;
+    uint64_t m_index_count;
+    uint64_t m_vertex_offset;
+    uint64_t m_index_offset;
+    std::array<float, 3> m_bounds_min;
+    std::array<float, 3> m_bounds_max;
+    std::array<file_attribute_t, mesh_file_t::max_attributes> m_attributes;
+};
+
+static_assert(std::is_trivially_copyable_v<file_header_t> && sizeof(file_header_t) == 400);
+static_assert(std::is_trivially_copyable_v<mesh_range_t> && sizeof(mesh_range_t) == 8);
+static_assert(opengl_cpp::vertex_layout.m_attributes.size() <= mesh_file_t::max_attributes);
+
+size_t align_payload(size_t offset) {
+    return (offset + mesh_file_t::payload_alignment - 1) / mesh_file_t::payload_alignment *
+           mesh_file_t::payload_alignment;
+}
+
+size_t get_index_size(index_type_t type) {
+    return type == index_type_t::unsigned_short ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+bool is_vertex_attrib_type(uint32_t type) {
+    switch (static_cast<vertex_attrib_type_t>(type)) {
+    case vertex_attrib_type_t::signed_byte:
+    case vertex_attrib_type_t::unsigned_byte:
+    case vertex_attrib_type_t::signed_short:
+    case vertex_attrib_type_t::unsigned_short:
+    case vertex_attrib_type_t::signed_int:
+    case vertex_attrib_type_t::unsigned_int:
+    case vertex_attrib_type_t::half_float:
+    case vertex_attrib_type_t::single_float:
+    case vertex_attrib_type_t::int_2_10_10_10_rev:
+    case vertex_attrib_type_t::unsigned_int_2_10_10_10_rev:
+        return true;
+    }
+    return false;
+}
+
+// Size of an attribute of components values of type, once is_vertex_attrib_type() accepted type.
+size_t get_attribute_size(vertex_attrib_type_t type, size_t components) {
+    switch (type) {
+    case vertex_attrib_type_t::signed_byte:
+    case vertex_attrib_type_t::unsigned_byte:
+        return components;
+    case vertex_attrib_type_t::signed_short:
+    case vertex_attrib_type_t::unsigned_short:
+    case vertex_attrib_type_t::half_float:
+        return components * 2;
+    case vertex_attrib_type_t::int_2_10_10_10_rev:
+    case vertex_attrib_type_t::unsigned_int_2_10_10_10_rev:
+        return 4; // Every component is packed into a single 32-bit value.
+    default:
+        return components * 4;
+    }
+}
+
+// Checks that [offset, offset + size) lies in a file of file_size bytes, without overflowing.
+bool fits(uint64_t offset, uint64_t count, uint64_t element_size, size_t file_size) {
+    return offset <= file_size && (element_size == 0 || count <= (file_size - offset) / element_size);
+}
+
+void write_padding(std::ofstream &file, size_t size) {
+    const std::array<char, mesh_file_t::payload_alignment> zeros{};
+    file.write(zeros.data(), static_cast<std::streamsize>(size));
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+mesh_file_t::mesh_file_t(const std::filesystem::path &path) : m_file(path) {
+    const auto data = m_file.get_view();
+    const auto fail = [&](const std::string &reason) {
+        return std::runtime_error("invalid mesh file " + path.string() + ": " + reason);
+    };
+
+    file_header_t header{};
+    if (data.size() < sizeof(header)) {
+        throw fail("bad identifier");
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.m_magic != magic) {
+        throw fail("bad identifier");
+    }
+    if (header.m_version != version) {
+        throw fail("unsupported version " + std::to_string(header.m_version));
+    }
+
+    m_vertex_count = header.m_vertex_count;
+    m_index_count = header.m_index_count;
+    m_stride = header.m_stride;
+    m_bounds_min = glm::vec3(header.m_bounds_min[0], header.m_bounds_min[1], header.m_bounds_min[2]);
+    m_bounds_max = glm::vec3(header.m_bounds_max[0], header.m_bounds_max[1], header.m_bounds_max[2]);
+
+    if (header.m_attribute_count == 0 || header.m_attribute_count > max_attributes) {
+        throw fail("bad attribute count");
+    }
+    for (size_t i = 0; i < header.m_attribute_count; ++i) {
+        const auto &attribute = header.m_attributes[i];
+        if (attribute.m_components < 1 || attribute.m_components > 4 || !is_vertex_attrib_type(attribute.m_type) ||
+            attribute.m_offset > m_stride ||
+            get_attribute_size(static_cast<vertex_attrib_type_t>(attribute.m_type), attribute.m_components) >
+                m_stride - attribute.m_offset) {
+            throw fail("bad attribute " + std::to_string(i));
+        }
+        m_attributes.push_back({attribute.m_location, attribute.m_components,
+                                static_cast<vertex_attrib_type_t>(attribute.m_type), attribute.m_normalized != 0,
+                                attribute.m_offset});
+    }
+
+    switch (static_cast<index_type_t>(header.m_index_type)) {
+    case index_type_t::unsigned_short:
+    case index_type_t::unsigned_int:
+        m_index_type = static_cast<index_type_t>(header.m_index_type);
+        break;
+    default:
+        if (header.m_index_type != 0 || m_index_count != 0) {
+            throw fail("bad index type");
+        }
+    }
+
+    if (!fits(sizeof(header), header.m_submesh_count, sizeof(mesh_range_t), data.size())) {
+        throw fail("bad sub-mesh count");
+    }
+    m_submeshes.resize(header.m_submesh_count);
+    std::memcpy(m_submeshes.data(), data.data() + sizeof(header), m_submeshes.size() * sizeof(mesh_range_t));
+    const auto range_end = m_index_type == index_type_t::undefined ? m_vertex_count : m_index_count;
+    for (const auto &submesh : m_submeshes) {
+        if (submesh.m_first > range_end || submesh.m_count > range_end - submesh.m_first) {
+            throw fail("sub-mesh out of the mesh");
+        }
+    }
+
+    // Mappings start on a page boundary, so aligned offsets are aligned addresses.
+    if (header.m_vertex_offset % payload_alignment != 0 ||
+        !fits(header.m_vertex_offset, m_vertex_count, m_stride, data.size())) {
+        throw fail("bad vertex payload");
+    }
+    m_vertex_data = data.substr(header.m_vertex_offset, m_vertex_count * m_stride);
+
+    if (m_index_type != index_type_t::undefined) {
+        const auto index_size = get_index_size(m_index_type);
+        if (header.m_index_offset % payload_alignment != 0 ||
+            !fits(header.m_index_offset, m_index_count, index_size, data.size())) {
+            throw fail("bad index payload");
+        }
+        m_index_data = data.substr(header.m_index_offset, m_index_count * index_size);
+    }
+}
+
+void mesh_file_t::write(const std::filesystem::path &path, const std::vector<vertex_t> &vertices,
+                        const std::vector<unsigned> &indices, std::vector<mesh_range_t> submeshes) {
+    file_header_t header{};
+    header.m_magic = magic;
+    header.m_version = version;
+    header.m_stride = vertex_layout.m_stride;
+    header.m_attribute_count = static_cast<uint32_t>(vertex_layout.m_attributes.size());
+    for (size_t i = 0; i < vertex_layout.m_attributes.size(); ++i) {
+        const auto &attribute = vertex_layout.m_attributes[i];
+        header.m_attributes[i] = {attribute.m_location, static_cast<uint32_t>(attribute.m_components),
+                                  static_cast<uint32_t>(attribute.m_type), attribute.m_normalized ? 1U : 0U,
+                                  attribute.m_offset};
+    }
+
+    if (!vertices.empty()) {
+        auto min = vertices.front().m_pos;
+        auto max = min;
+        for (const auto &v : vertices) {
+            for (int i = 0; i < 3; ++i) {
+                min[i] = std::min(min[i], v.m_pos[i]);
+                max[i] = std::max(max[i], v.m_pos[i]);
+            }
+        }
+        header.m_bounds_min = {min.x, min.y, min.z};
+        header.m_bounds_max = {max.x, max.y, max.z};
+    }
+
+    for (const auto index : indices) {
+        if (index >= vertices.size()) {
+            throw std::out_of_range("mesh index " + std::to_string(index) + " out of " +
+                                    std::to_string(vertices.size()) + " vertices");
+        }
+    }
+
+    // Indices are narrowed with the same rule vertex_array_t::load() uses.
+    std::vector<uint16_t> narrow;
+    const void *index_data = indices.data();
+    auto index_type = index_type_t::unsigned_int;
+    if (vertices.size() <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+        narrow.reserve(indices.size());
+        for (const auto index : indices) {
+            narrow.push_back(static_cast<uint16_t>(index));
+        }
+        index_data = narrow.data();
+        index_type = index_type_t::unsigned_short;
+    }
+    const auto index_size = indices.size() * get_index_size(index_type);
+
+    const auto range_end = indices.empty() ? vertices.size() : indices.size();
+    if (submeshes.empty()) {
+        submeshes.push_back({0, static_cast<uint32_t>(range_end)});
+    }
+    for (const auto &submesh : submeshes) {
+        assert(size_t{submesh.m_first} + submesh.m_count <= range_end);
+    }
+
+    header.m_index_type = indices.empty() ? 0 : static_cast<uint32_t>(index_type);
+    header.m_submesh_count = static_cast<uint32_t>(submeshes.size());
+    header.m_vertex_count = vertices.size();
+    header.m_index_count = indices.size();
+    const auto table_end = sizeof(header) + submeshes.size() * sizeof(mesh_range_t);
+    header.m_vertex_offset = align_payload(table_end);
+    const auto vertex_end = header.m_vertex_offset + vertices.size() * sizeof(vertex_t);
+    header.m_index_offset = indices.empty() ? 0 : align_payload(vertex_end);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header)); // NOLINT(*-reinterpret-cast)
+    file.write(reinterpret_cast<const char *>(submeshes.data()),         // NOLINT(*-reinterpret-cast)
+               static_cast<std::streamsize>(submeshes.size() * sizeof(mesh_range_t)));
+    write_padding(file, header.m_vertex_offset - table_end);
+    file.write(reinterpret_cast<const char *>(vertices.data()), // NOLINT(*-reinterpret-cast)
+               static_cast<std::streamsize>(vertices.size() * sizeof(vertex_t)));
+    if (!indices.empty()) {
+        write_padding(file, header.m_index_offset - vertex_end);
+        file.write(static_cast<const char *>(index_data), static_cast<std::streamsize>(index_size));
+    }
+    if (!file) {
+        throw std::runtime_error("cannot write mesh file: " + path.string());
+    }
+}
+
+vertex_array_t mesh_file_t::load(gl_t &gl) const {
+    vertex_array_t vertex_array(gl);
+    vertex_array.load(m_vertex_data.data(), m_vertex_count, m_attributes.data(), m_attributes.size(), m_stride);
+    if (m_index_type != index_type_t::undefined) {
+        vertex_array.load_indices(m_index_data.data(), m_index_count, m_index_type);
+    }
+    return vertex_array;
+}
+
+std::string_view mesh_file_t::get_vertex_data() const {
+    return m_vertex_data;
+}
+
+std::string_view mesh_file_t::get_index_data() const {
+    return m_index_data;
+}
+
+size_t mesh_file_t::get_vertex_count() const {
+    return m_vertex_count;
+}
+
+size_t mesh_file_t::get_index_count() const {
+    return m_index_count;
+}
+
+index_type_t mesh_file_t::get_index_type() const {
+    return m_index_type;
+}
+
+size_t mesh_file_t::get_stride() const {
+    return m_stride;
+}
+
+const std::vector<vertex_attribute_t> &mesh_file_t::get_attributes() const {
+    return m_attributes;
+}
+
+const glm::vec3 &mesh_file_t::get_bounds_min() const {
+    return m_bounds_min;
+}
+
+const glm::vec3 &mesh_file_t::get_bounds_max() const {
+    return m_bounds_max;
+}
+
+const std::vector<mesh_range_t> &mesh_file_t::get_submeshes() const {
+    return m_submeshes;
+}
+
+std::ostream &operator<<(std::ostream &os, const mesh_file_t &f) {
+    return os << "mesh_file(" << &f << ") vertices=" << f.get_vertex_count() << ", indices=" << f.get_index_count()
+              << ", submeshes=" << f.get_submeshes().size();
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,811 @@
+#include "mesh_importer.h"
+
+#include "mapped_file.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace {
+
+using opengl_cpp::mesh_data_t;
+using opengl_cpp::vertex_t;
+
+constexpr uint32_t no_index = 0;
+constexpr uint32_t empty_slot = UINT32_MAX;
+
+// Runs task(i) for every i in [0, count) on up to threads threads, then rethrows the first error raised, if any.
+template <class task_t> void parallel_for(size_t count, size_t threads, const task_t &task) {
+    std::vector<std::exception_ptr> errors(count);
+    std::atomic<size_t> next{0};
+    const auto work = [&] {
+        for (auto i = next++; i < count; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(threads, count); ++i) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    for (const auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Parses a decimal number, without the locale lookups and the null terminator strtod needs.
+double parse_number(std::string_view text) {
+    constexpr std::array<double, 23> powers = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                               1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    constexpr int max_digits = 19;
+
+    size_t i = 0;
+    const bool negative = i < text.size() && text[i] == '-';
+    if (i < text.size() && (text[i] == '-' || text[i] == '+')) {
+        ++i;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    const auto add_digit = [&](char c, bool fraction) {
+        if (digits < max_digits) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(c - '0');
+            digits += mantissa > 0 ? 1 : 0;
+            exponent -= fraction ? 1 : 0;
+        } else if (!fraction) {
+            ++exponent;
+        }
+    };
+    for (; i < text.size() && is_digit(text[i]); ++i) {
+        add_digit(text[i], false);
+    }
+    if (i < text.size() && text[i] == '.') {
+        for (++i; i < text.size() && is_digit(text[i]); ++i) {
+            add_digit(text[i], true);
+        }
+    }
+    if (i < text.size() && (text[i] == 'e' || text[i] == 'E')) {
+        ++i;
+        const bool negative_exponent = i < text.size() && text[i] == '-';
+        if (i < text.size() && (text[i] == '-' || text[i] == '+')) {
+            ++i;
+        }
+        int e = 0;
+        for (; i < text.size() && is_digit(text[i]); ++i) {
+            e = std::min(e * 10 + (text[i] - '0'), 1000);
+        }
+        exponent += negative_exponent ? -e : e;
+    }
+
+    auto value = static_cast<double>(mantissa);
+    if (exponent < 0 && -exponent < static_cast<int>(powers.size())) {
+        value /= powers[static_cast<size_t>(-exponent)];
+    } else if (exponent >= 0 && exponent < static_cast<int>(powers.size())) {
+        value *= powers[static_cast<size_t>(exponent)];
+    } else {
+        value *= std::pow(10.0, exponent);
+    }
+    return negative ? -value : value;
+}
+
+// Reads the lines of an OBJ chunk, token by token.
+class obj_reader_t {
+  public:
+    explicit obj_reader_t(std::string_view text) : m_text(text) {
+    }
+
+    [[nodiscard]] bool at_end() const {
+        return m_pos >= m_text.size();
+    }
+
+    // Next token of the current line, empty at the end of the line.
+    std::string_view token() {
+        while (m_pos < m_text.size() && is_blank(m_text[m_pos])) {
+            ++m_pos;
+        }
+        const auto begin = m_pos;
+        while (m_pos < m_text.size() && !is_blank(m_text[m_pos]) && m_text[m_pos] != '\n') {
+            ++m_pos;
+        }
+        return m_text.substr(begin, m_pos - begin);
+    }
+
+    void next_line() {
+        const auto end = m_text.find('\n', m_pos);
+        m_pos = end == std::string_view::npos ? m_text.size() : end + 1;
+    }
+
+  private:
+    std::string_view m_text;
+    size_t m_pos{};
+
+    static bool is_blank(char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+};
+
+struct obj_counts_t {
+    size_t m_positions;
+    size_t m_tex;
+    size_t m_normals;
+    size_t m_corners;
+};
+
+// Indices of a face corner, 1-based, no_index when absent.
+struct obj_corner_t {
+    uint32_t m_position;
+    uint32_t m_tex;
+    uint32_t m_normal;
+};
+
+bool operator==(const obj_corner_t &a, const obj_corner_t &b) {
+    return a.m_position == b.m_position && a.m_tex == b.m_tex && a.m_normal == b.m_normal;
+}
+
+size_t hash(const obj_corner_t &c) {
+    auto h = uint64_t{c.m_position} * 0x9E3779B97F4A7C15ULL;
+    h ^= (uint64_t{c.m_tex} + (h << 6) + (h >> 2)) * 0xC2B2AE3D27D4EB4FULL;
+    h ^= (uint64_t{c.m_normal} + (h << 6) + (h >> 2)) * 0x165667B19E3779F9ULL;
+    return static_cast<size_t>(h ^ (h >> 32));
+}
+
+// Resolves a 1-based index, or a negative one relative to the count of elements read so far.
+uint32_t resolve_index(std::string_view token, size_t count) {
+    if (token.empty()) {
+        return no_index;
+    }
+    const auto value = static_cast<long long>(parse_number(token));
+    const auto index = value < 0 ? static_cast<long long>(count) + value + 1 : value;
+    if (index <= 0 || index > UINT32_MAX) {
+        throw std::runtime_error("invalid OBJ face index: " + std::string(token));
+    }
+    return static_cast<uint32_t>(index);
+}
+
+size_t count_face_vertices(obj_reader_t &reader) {
+    size_t count = 0;
+    while (!reader.token().empty()) {
+        ++count;
+    }
+    if (count < 3) {
+        throw std::runtime_error("OBJ face with less than 3 vertices");
+    }
+    return count;
+}
+
+obj_counts_t count_obj_chunk(std::string_view chunk) {
+    obj_counts_t counts{};
+    for (obj_reader_t reader(chunk); !reader.at_end(); reader.next_line()) {
+        const auto keyword = reader.token();
+        if (keyword == "v") {
+            ++counts.m_positions;
+        } else if (keyword == "vt") {
+            ++counts.m_tex;
+        } else if (keyword == "vn") {
+            ++counts.m_normals;
+        } else if (keyword == "f") {
+            counts.m_corners += (count_face_vertices(reader) - 2) * 3;
+        }
+    }
+    return counts;
+}
+
+struct obj_streams_t {
+    std::vector<glm::vec3> m_positions;
+    std::vector<glm::vec2> m_tex;
+    std::vector<glm::vec3> m_normals;
+    std::vector<obj_corner_t> m_corners;
+};
+
+// Parses a chunk into the streams, from the offsets its elements start at.
+void parse_obj_chunk(std::string_view chunk, obj_counts_t at, obj_streams_t &streams) {
+    for (obj_reader_t reader(chunk); !reader.at_end(); reader.next_line()) {
+        const auto keyword = reader.token();
+        if (keyword == "v") {
+            auto &p = streams.m_positions[at.m_positions++];
+            for (int i = 0; i < 3; ++i) {
+                p[i] = static_cast<float>(parse_number(reader.token()));
+            }
+        } else if (keyword == "vt") {
+            auto &t = streams.m_tex[at.m_tex++];
+            for (int i = 0; i < 2; ++i) {
+                t[i] = static_cast<float>(parse_number(reader.token()));
+            }
+        } else if (keyword == "vn") {
+            auto &n = streams.m_normals[at.m_normals++];
+            for (int i = 0; i < 3; ++i) {
+                n[i] = static_cast<float>(parse_number(reader.token()));
+            }
+        } else if (keyword == "f") {
+            // Triangle fan around the first corner.
+            obj_corner_t first{};
+            obj_corner_t previous{};
+            size_t count = 0;
+            for (auto token = reader.token(); !token.empty(); token = reader.token(), ++count) {
+                const auto slash = token.find('/');
+                const auto position = token.substr(0, slash);
+                const auto rest = slash == std::string_view::npos ? std::string_view() : token.substr(slash + 1);
+                const auto slash2 = rest.find('/');
+                const auto tex = rest.substr(0, slash2);
+                const auto normal = slash2 == std::string_view::npos ? std::string_view() : rest.substr(slash2 + 1);
+
+                const obj_corner_t corner{resolve_index(position, at.m_positions), resolve_index(tex, at.m_tex),
+                                          resolve_index(normal, at.m_normals)};
+                if (corner.m_position == no_index) {
+                    throw std::runtime_error("OBJ face corner without position: " + std::string(token));
+                }
+                if (count >= 2) {
+                    streams.m_corners[at.m_corners++] = first;
+                    streams.m_corners[at.m_corners++] = previous;
+                    streams.m_corners[at.m_corners++] = corner;
+                }
+                first = count == 0 ? corner : first;
+                previous = corner;
+            }
+        }
+    }
+}
+
+// Minimal JSON document, enough to walk the glTF scene description. Strings point into the parsed text, unescaped.
+struct json_t {
+    enum class kind_t { null, boolean, number, string, array, object };
+
+    kind_t m_kind{kind_t::null};
+    double m_number{};
+    std::string_view m_string;
+    std::vector<json_t> m_items;
+    std::vector<std::pair<std::string_view, json_t>> m_members;
+
+    [[nodiscard]] const json_t *find(std::string_view key) const {
+        for (const auto &member : m_members) {
+            if (member.first == key) {
+                return &member.second;
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] const json_t &at(std::string_view key) const {
+        const auto *value = find(key);
+        if (!value) {
+            throw std::runtime_error("glTF property not found: " + std::string(key));
+        }
+        return *value;
+    }
+
+    [[nodiscard]] const json_t &at(size_t index) const {
+        if (m_kind != kind_t::array || index >= m_items.size()) {
+            throw std::runtime_error("glTF index out of range: " + std::to_string(index));
+        }
+        return m_items[index];
+    }
+
+    [[nodiscard]] size_t get_size() const {
+        // The largest size_t rounds up to 2^64 as a double, which is out of range. NaN fails every comparison.
+        constexpr auto limit = static_cast<double>(std::numeric_limits<size_t>::max());
+        if (m_kind != kind_t::number || !(m_number >= 0 && m_number < limit) || std::floor(m_number) != m_number) {
+            throw std::runtime_error("glTF value is not a valid size");
+        }
+        return static_cast<size_t>(m_number);
+    }
+
+    [[nodiscard]] size_t get_size(std::string_view key, size_t fallback) const {
+        const auto *value = find(key);
+        return value ? value->get_size() : fallback;
+    }
+};
+
+class json_parser_t {
+  public:
+    explicit json_parser_t(std::string_view text) : m_text(text) {
+    }
+
+    json_t parse() {
+        auto value = parse_value();
+        skip_blanks();
+        if (m_pos != m_text.size()) {
+            fail();
+        }
+        return value;
+    }
+
+  private:
+    // glTF documents nest a few levels only, deeper ones would just grow the stack until it overflows.
+    static constexpr size_t max_depth = 64;
+
+    std::string_view m_text;
+    size_t m_pos{};
+
+    [[noreturn]] void fail() const {
+        throw std::runtime_error("invalid glTF JSON at offset " + std::to_string(m_pos));
+    }
+
+    void skip_blanks() {
+        while (m_pos < m_text.size() &&
+               (m_text[m_pos] == ' ' || m_text[m_pos] == '\t' || m_text[m_pos] == '\n' || m_text[m_pos] == '\r')) {
+            ++m_pos;
+        }
+    }
+
+    void expect(char c) {
+        skip_blanks();
+        if (m_pos >= m_text.size() || m_text[m_pos] != c) {
+            fail();
+        }
+        ++m_pos;
+    }
+
+    bool consume_separator() {
+        skip_blanks();
+        if (m_pos < m_text.size() && m_text[m_pos] == ',') {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    bool consume(std::string_view word) {
+        if (m_text.substr(m_pos, word.size()) != word) {
+            return false;
+        }
+        m_pos += word.size();
+        return true;
+    }
+
+    std::string_view parse_string() {
+        expect('"');
+        const auto begin = m_pos;
+        while (m_pos < m_text.size() && m_text[m_pos] != '"') {
+            m_pos += m_text[m_pos] == '\\' ? 2 : 1;
+        }
+        if (m_pos >= m_text.size()) {
+            fail();
+        }
+        return m_text.substr(begin, m_pos++ - begin);
+    }
+
+    json_t parse_value(size_t depth = 0) {
+        skip_blanks();
+        if (m_pos >= m_text.size() || depth > max_depth) {
+            fail();
+        }
+
+        json_t value;
+        const auto c = m_text[m_pos];
+        if (c == '{') {
+            value.m_kind = json_t::kind_t::object;
+            ++m_pos;
+            skip_blanks();
+            if (m_pos < m_text.size() && m_text[m_pos] == '}') {
+                ++m_pos;
+                return value;
+            }
+            while (true) {
+                const auto key = parse_string();
+                expect(':');
+                value.m_members.emplace_back(key, parse_value(depth + 1));
+                if (!consume_separator()) {
+                    break;
+                }
+            }
+            expect('}');
+        } else if (c == '[') {
+            value.m_kind = json_t::kind_t::array;
+            ++m_pos;
+            skip_blanks();
+            if (m_pos < m_text.size() && m_text[m_pos] == ']') {
+                ++m_pos;
+                return value;
+            }
+            while (true) {
+                value.m_items.push_back(parse_value(depth + 1));
+                if (!consume_separator()) {
+                    break;
+                }
+            }
+            expect(']');
+        } else if (c == '"') {
+            value.m_kind = json_t::kind_t::string;
+            value.m_string = parse_string();
+        } else if (consume("true")) {
+            value.m_kind = json_t::kind_t::boolean;
+            value.m_number = 1;
+        } else if (consume("false")) {
+            value.m_kind = json_t::kind_t::boolean;
+        } else if (consume("null")) {
+            value.m_kind = json_t::kind_t::null;
+        } else {
+            const auto begin = m_pos;
+            constexpr std::string_view number_chars = "0123456789+-.eE";
+            while (m_pos < m_text.size() && number_chars.find(m_text[m_pos]) != std::string_view::npos) {
+                ++m_pos;
+            }
+            if (begin == m_pos) {
+                fail();
+            }
+            value.m_kind = json_t::kind_t::number;
+            value.m_number = parse_number(m_text.substr(begin, m_pos - begin));
+        }
+        return value;
+    }
+};
+
+constexpr uint32_t glb_magic = 0x46546C67;      // "glTF"
+constexpr uint32_t glb_chunk_json = 0x4E4F534A; // "JSON"
+constexpr uint32_t glb_chunk_bin = 0x004E4942;  // "BIN\0"
+constexpr size_t glb_header_size = 12;
+constexpr size_t glb_chunk_header_size = 8;
+constexpr size_t gltf_triangles = 4;
+
+enum class gltf_component_t : unsigned {
+    unsigned_byte = 5121,
+    unsigned_short = 5123,
+    unsigned_int = 5125,
+    single_float = 5126
+};
+
+uint32_t read_u32(std::string_view data, size_t offset) {
+    uint32_t value = 0;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+// Elements of a glTF accessor, within the binary chunk.
+struct accessor_view_t {
+    const char *m_data;
+    size_t m_count;
+    size_t m_stride;
+    gltf_component_t m_component;
+    size_t m_components;
+    bool m_normalized;
+
+    [[nodiscard]] float get_float(size_t element, size_t component) const {
+        const auto *p = m_data + element * m_stride;
+        switch (m_component) {
+        case gltf_component_t::unsigned_byte: {
+            const auto v = static_cast<float>(static_cast<unsigned char>(p[component]));
+            return m_normalized ? v / 255.0F : v;
+        }
+        case gltf_component_t::unsigned_short: {
+            uint16_t v = 0;
+            std::memcpy(&v, p + component * sizeof(v), sizeof(v));
+            return m_normalized ? static_cast<float>(v) / 65535.0F : static_cast<float>(v);
+        }
+        case gltf_component_t::unsigned_int: {
+            uint32_t v = 0;
+            std::memcpy(&v, p + component * sizeof(v), sizeof(v));
+            return static_cast<float>(v);
+        }
+        default: {
+            float v = 0;
+            std::memcpy(&v, p + component * sizeof(v), sizeof(v));
+            return v;
+        }
+        }
+    }
+
+    [[nodiscard]] uint32_t get_index(size_t element) const {
+        const auto *p = m_data + element * m_stride;
+        switch (m_component) {
+        case gltf_component_t::unsigned_byte:
+            return static_cast<unsigned char>(*p);
+        case gltf_component_t::unsigned_short: {
+            uint16_t v = 0;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        default: {
+            uint32_t v = 0;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        }
+    }
+};
+
+size_t get_component_size(gltf_component_t component) {
+    switch (component) {
+    case gltf_component_t::unsigned_byte:
+        return 1;
+    case gltf_component_t::unsigned_short:
+        return 2;
+    case gltf_component_t::unsigned_int:
+    case gltf_component_t::single_float:
+        return 4;
+    default:
+        throw std::runtime_error("unsupported glTF component type: " +
+                                 std::to_string(static_cast<unsigned>(component)));
+    }
+}
+
+size_t get_type_components(std::string_view type) {
+    if (type == "SCALAR") {
+        return 1;
+    }
+    if (type == "VEC2") {
+        return 2;
+    }
+    if (type == "VEC3") {
+        return 3;
+    }
+    if (type == "VEC4") {
+        return 4;
+    }
+    throw std::runtime_error("unsupported glTF accessor type: " + std::string(type));
+}
+
+accessor_view_t get_accessor(const json_t &gltf, size_t index, std::string_view bin, size_t min_components) {
+    const auto &accessor = gltf.at("accessors").at(index);
+    const auto &view = gltf.at("bufferViews").at(accessor.get_size("bufferView", SIZE_MAX));
+    if (view.get_size("buffer", 0) != 0) {
+        throw std::runtime_error("glTF external buffers are not supported");
+    }
+
+    accessor_view_t a{};
+    a.m_count = accessor.get_size("count", 0);
+    a.m_component = static_cast<gltf_component_t>(accessor.get_size("componentType", 0));
+    a.m_components = get_type_components(accessor.at("type").m_string);
+    const auto *normalized = accessor.find("normalized");
+    a.m_normalized = normalized && normalized->m_number != 0;
+    const auto element_size = get_component_size(a.m_component) * a.m_components;
+    a.m_stride = view.get_size("byteStride", element_size);
+    if (a.m_components < min_components) {
+        throw std::runtime_error("glTF accessor has too few components: " + std::to_string(index));
+    }
+
+    const auto view_offset = view.get_size("byteOffset", 0);
+    const auto view_length = view.get_size("byteLength", 0);
+    const auto offset = accessor.get_size("byteOffset", 0);
+    const auto used = a.m_count == 0 ? 0 : offset + (a.m_count - 1) * a.m_stride + element_size;
+    if (used > view_length || view_offset + view_length > bin.size()) {
+        throw std::runtime_error("glTF accessor out of its buffer: " + std::to_string(index));
+    }
+    a.m_data = bin.data() + view_offset + offset;
+    return a;
+}
+
+// Accessors of a glTF primitive, and where its vertices and indices start in the merged mesh.
+struct glb_primitive_t {
+    accessor_view_t m_positions;
+    accessor_view_t m_normals; // Empty when absent.
+    accessor_view_t m_texes;   // Empty when absent.
+    accessor_view_t m_indices;
+    bool m_indexed;
+    size_t m_first_vertex;
+    size_t m_first_index;
+    size_t m_index_count;
+};
+
+} // namespace
+
+namespace opengl_cpp {
+
+mesh_importer_t::mesh_importer_t(size_t threads)
+    : m_threads(threads == 0 ? std::max<size_t>(1, std::thread::hardware_concurrency()) : threads) {
+}
+
+mesh_data_t mesh_importer_t::import(const std::filesystem::path &path) const {
+    const mapped_file_t file(path);
+    const auto extension = path.extension();
+    if (extension == ".obj") {
+        return import_obj(file.get_view());
+    }
+    if (extension == ".glb") {
+        return import_glb(file.get_view());
+    }
+    throw std::runtime_error("unknown mesh format: " + path.string());
+}
+
+mesh_data_t mesh_importer_t::import_obj(std::string_view text) const {
+    // Chunks end on line boundaries, so no line is split between two of them.
+    std::vector<std::string_view> chunks;
+    size_t begin = 0;
+    for (size_t i = 1; i <= m_threads && begin < text.size(); ++i) {
+        auto end = i == m_threads ? text.size() : std::max(begin, text.size() * i / m_threads);
+        end = std::min(text.find('\n', end), text.size());
+        end = end == text.size() ? end : end + 1;
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+
+    std::vector<obj_counts_t> counts(chunks.size());
+    parallel_for(chunks.size(), m_threads, [&](size_t i) { counts[i] = count_obj_chunk(chunks[i]); });
+
+    // Each chunk writes its elements after the ones of the previous chunks.
+    obj_counts_t total{};
+    std::vector<obj_counts_t> offsets(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        offsets[i] = total;
+        total.m_positions += counts[i].m_positions;
+        total.m_tex += counts[i].m_tex;
+        total.m_normals += counts[i].m_normals;
+        total.m_corners += counts[i].m_corners;
+    }
+
+    obj_streams_t streams{std::vector<glm::vec3>(total.m_positions), std::vector<glm::vec2>(total.m_tex),
+                          std::vector<glm::vec3>(total.m_normals), std::vector<obj_corner_t>(total.m_corners)};
+    parallel_for(chunks.size(), m_threads, [&](size_t i) { parse_obj_chunk(chunks[i], offsets[i], streams); });
+
+    // Merge identical corners into shared vertices, through an open-addressing table at most half full.
+    size_t table_size = 16;
+    while (table_size < total.m_corners * 2) {
+        table_size *= 2;
+    }
+    std::vector<uint32_t> table(table_size, empty_slot);
+    std::vector<obj_corner_t> unique;
+    unique.reserve(total.m_corners);
+
+    mesh_data_t mesh;
+    mesh.m_vertices.reserve(total.m_corners);
+    mesh.m_indices.reserve(total.m_corners);
+    for (const auto &corner : streams.m_corners) {
+        if (corner.m_position > total.m_positions || corner.m_tex > total.m_tex || corner.m_normal > total.m_normals) {
+            throw std::runtime_error("OBJ face refers to a missing element");
+        }
+
+        auto slot = hash(corner) & (table_size - 1);
+        while (table[slot] != empty_slot && !(unique[table[slot]] == corner)) {
+            slot = (slot + 1) & (table_size - 1);
+        }
+        if (table[slot] == empty_slot) {
+            table[slot] = static_cast<uint32_t>(unique.size());
+            unique.push_back(corner);
+
+            vertex_t v{};
+            v.m_pos = streams.m_positions[corner.m_position - 1];
+            if (corner.m_tex != no_index) {
+                v.m_tex = streams.m_tex[corner.m_tex - 1];
+            }
+            if (corner.m_normal != no_index) {
+                v.m_nor = streams.m_normals[corner.m_normal - 1];
+            }
+            mesh.m_vertices.push_back(v);
+        }
+        mesh.m_indices.push_back(table[slot]);
+    }
+    return mesh;
+}
+
+mesh_data_t mesh_importer_t::import_glb(std::string_view data) const {
+    if (data.size() < glb_header_size + glb_chunk_header_size || read_u32(data, 0) != glb_magic ||
+        read_u32(data, 4) != 2) {
+        throw std::runtime_error("not a glTF 2.0 binary file");
+    }
+
+    std::string_view json_text;
+    std::string_view bin;
+    for (size_t offset = glb_header_size; offset + glb_chunk_header_size <= data.size();) {
+        const auto length = static_cast<size_t>(read_u32(data, offset));
+        const auto type = read_u32(data, offset + 4);
+        offset += glb_chunk_header_size;
+        if (length > data.size() - offset) {
+            throw std::runtime_error("truncated glTF chunk");
+        }
+        if (type == glb_chunk_json && json_text.empty()) {
+            json_text = data.substr(offset, length);
+        } else if (type == glb_chunk_bin && bin.empty()) {
+            bin = data.substr(offset, length);
+        }
+        offset += length;
+    }
+
+    const auto gltf = json_parser_t(json_text).parse();
+    const auto *meshes = gltf.find("meshes");
+    if (!meshes) {
+        return {};
+    }
+
+    // Read the accessors and size both streams once for every primitive, so each one knows where it is written.
+    std::vector<glb_primitive_t> primitives;
+    size_t vertex_count = 0;
+    size_t index_count = 0;
+    for (const auto &m : meshes->m_items) {
+        for (const auto &primitive : m.at("primitives").m_items) {
+            if (primitive.get_size("mode", gltf_triangles) != gltf_triangles) {
+                throw std::runtime_error("only glTF triangle lists are supported");
+            }
+
+            glb_primitive_t p{};
+            const auto &attributes = primitive.at("attributes");
+            p.m_positions = get_accessor(gltf, attributes.at("POSITION").get_size(), bin, 3);
+            if (const auto *normal = attributes.find("NORMAL")) {
+                p.m_normals = get_accessor(gltf, normal->get_size(), bin, 3);
+            }
+            if (const auto *tex = attributes.find("TEXCOORD_0")) {
+                p.m_texes = get_accessor(gltf, tex->get_size(), bin, 2);
+            }
+            if ((p.m_normals.m_data && p.m_normals.m_count != p.m_positions.m_count) ||
+                (p.m_texes.m_data && p.m_texes.m_count != p.m_positions.m_count)) {
+                throw std::runtime_error("glTF attributes with different counts");
+            }
+
+            const auto *indices = primitive.find("indices");
+            p.m_indexed = indices != nullptr;
+            if (p.m_indexed) {
+                p.m_indices = get_accessor(gltf, indices->get_size(), bin, 1);
+            }
+            p.m_first_vertex = vertex_count;
+            p.m_first_index = index_count;
+            p.m_index_count = p.m_indexed ? p.m_indices.m_count : p.m_positions.m_count;
+            vertex_count += p.m_positions.m_count;
+            index_count += p.m_index_count;
+            primitives.push_back(p);
+        }
+    }
+
+    mesh_data_t mesh;
+    mesh.m_vertices.resize(vertex_count);
+    mesh.m_indices.resize(index_count);
+
+    // Split the vertices and indices of the whole file in even ranges, one per task, whatever the primitives they
+    // belong to. Files made of many small primitives then start the threads once, not once per primitive.
+    const auto tasks = std::min(m_threads, std::max<size_t>(1, vertex_count + index_count));
+    parallel_for(tasks, m_threads, [&](size_t task) {
+        const auto vertex_begin = vertex_count * task / tasks;
+        const auto vertex_end = vertex_count * (task + 1) / tasks;
+        const auto index_begin = index_count * task / tasks;
+        const auto index_end = index_count * (task + 1) / tasks;
+
+        for (const auto &p : primitives) {
+            const auto count = p.m_positions.m_count;
+            const auto first = std::max(vertex_begin, p.m_first_vertex) - p.m_first_vertex;
+            const auto last = std::min(vertex_end, p.m_first_vertex + count);
+            for (auto i = first; p.m_first_vertex + i < last; ++i) {
+                auto &v = mesh.m_vertices[p.m_first_vertex + i];
+                v.m_pos = glm::vec3(p.m_positions.get_float(i, 0), p.m_positions.get_float(i, 1),
+                                    p.m_positions.get_float(i, 2));
+                if (p.m_normals.m_data) {
+                    v.m_nor = glm::vec3(p.m_normals.get_float(i, 0), p.m_normals.get_float(i, 1),
+                                        p.m_normals.get_float(i, 2));
+                }
+                if (p.m_texes.m_data) {
+                    v.m_tex = glm::vec2(p.m_texes.get_float(i, 0), p.m_texes.get_float(i, 1));
+                }
+            }
+
+            const auto first_index = std::max(index_begin, p.m_first_index) - p.m_first_index;
+            const auto last_index = std::min(index_end, p.m_first_index + p.m_index_count);
+            for (auto i = first_index; p.m_first_index + i < last_index; ++i) {
+                const auto index = p.m_indexed ? p.m_indices.get_index(i) : i;
+                if (index >= count) {
+                    throw std::runtime_error("glTF index out of its primitive: " + std::to_string(index));
+                }
+                mesh.m_indices[p.m_first_index + i] = static_cast<unsigned>(p.m_first_vertex + index);
+            }
+        }
+    });
+    return mesh;
+}
+
+size_t mesh_importer_t::get_threads() const {
+    return m_threads;
+}
+
+std::ostream &operator<<(std::ostream &os, const mesh_importer_t &i) {
+    return os << "mesh_importer(" << &i << ") threads=" << i.get_threads();
+}
+
+} // namespace opengl_cpp
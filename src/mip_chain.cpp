@@ -0,0 +1,344 @@
+#include "mip_chain.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <xmmintrin.h>
+#define OPENGL_CPP_MIP_CHAIN_SSE
+#endif
+
+namespace {
+
+using opengl_cpp::mip_filter_t;
+
+constexpr size_t row_alignment = 4;
+constexpr size_t alpha_channel = 3;
+constexpr size_t encode_table_size = 4096;
+constexpr double kaiser_alpha = 4.0;
+constexpr double kaiser_radius = 4.0;
+constexpr int kaiser_taps = 8;
+constexpr double pi = 3.14159265358979323846;
+
+// Source texels weighted into each destination texel, starting at the source texel twice its index plus m_first.
+struct kernel_t {
+    int m_first;
+    std::vector<float> m_weights;
+};
+
+size_t get_stride(size_t width, size_t channels) {
+    return (width * channels + row_alignment - 1) / row_alignment * row_alignment;
+}
+
+float srgb_to_linear(float c) {
+    return c <= 0.04045F ? c / 12.92F : std::pow((c + 0.055F) / 1.055F, 2.4F);
+}
+
+float linear_to_srgb(float c) {
+    return c <= 0.0031308F ? c * 12.92F : 1.055F * std::pow(c, 1.0F / 2.4F) - 0.055F;
+}
+
+const std::array<float, 256> &get_decode_table(bool srgb) {
+    static const auto tables = [] {
+        std::array<std::array<float, 256>, 2> t{};
+        for (size_t i = 0; i < 256; ++i) {
+            t[0][i] = static_cast<float>(i) / 255.0F;
+            t[1][i] = srgb_to_linear(t[0][i]);
+        }
+        return t;
+    }();
+    return tables[srgb ? 1 : 0];
+}
+
+// Encoding to sRGB through a table is much faster than a pow per texel, and fine enough for 8-bit results.
+unsigned char encode(float value, bool srgb) {
+    static const auto table = [] {
+        std::array<unsigned char, encode_table_size> t{};
+        for (size_t i = 0; i < t.size(); ++i) {
+            const auto c = linear_to_srgb(static_cast<float>(i) / (encode_table_size - 1));
+            t[i] = static_cast<unsigned char>(std::lround(c * 255.0F));
+        }
+        return t;
+    }();
+
+    value = std::clamp(value, 0.0F, 1.0F);
+    if (srgb) {
+        return table[static_cast<size_t>(value * (encode_table_size - 1) + 0.5F)];
+    }
+    return static_cast<unsigned char>(value * 255.0F + 0.5F);
+}
+
+double bessel_i0(double x) {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; term > sum * 1e-12; ++k) {
+        const auto f = x / (2.0 * k);
+        term *= f * f;
+        sum += term;
+    }
+    return sum;
+}
+
+kernel_t make_kernel(mip_filter_t filter) {
+    if (filter == mip_filter_t::box) {
+        return {0, {0.5F, 0.5F}};
+    }
+
+    // Sinc at the destination frequency, windowed by a Kaiser window spanning 4 source texels on each side.
+    kernel_t kernel{1 - kaiser_taps / 2, {}};
+    double total = 0.0;
+    std::vector<double> weights;
+    for (int tap = 0; tap < kaiser_taps; ++tap) {
+        const auto distance = (kernel.m_first + tap) - 0.5;
+        const auto x = pi * distance / 2.0;
+        const auto sinc = x == 0.0 ? 1.0 : std::sin(x) / x;
+        const auto r = distance / kaiser_radius;
+        const auto window = bessel_i0(kaiser_alpha * std::sqrt(1.0 - r * r)) / bessel_i0(kaiser_alpha);
+        weights.push_back(sinc * window);
+        total += weights.back();
+    }
+    for (const auto weight : weights) {
+        kernel.m_weights.push_back(static_cast<float>(weight / total));
+    }
+    return kernel;
+}
+
+size_t clamp_index(size_t index, int offset, size_t size) {
+    const auto i = static_cast<std::ptrdiff_t>(index) + offset;
+    return static_cast<size_t>(std::clamp<std::ptrdiff_t>(i, 0, static_cast<std::ptrdiff_t>(size) - 1));
+}
+
+// dst += src * weight, over count floats.
+void accumulate(float *dst, const float *src, float weight, size_t count) {
+    size_t i = 0;
+#ifdef OPENGL_CPP_MIP_CHAIN_SSE
+    const auto w = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] += src[i] * weight;
+    }
+}
+
+std::vector<float> reduce_rows(const std::vector<float> &src, size_t width, size_t height, size_t channels,
+                               const kernel_t &kernel) {
+    if (width == 1) {
+        return src;
+    }
+
+    const auto reduced = width / 2;
+    std::vector<float> dst(reduced * height * channels);
+    for (size_t y = 0; y < height; ++y) {
+        const auto *src_row = src.data() + y * width * channels;
+        auto *dst_row = dst.data() + y * reduced * channels;
+        for (size_t x = 0; x < reduced; ++x) {
+            auto *texel = dst_row + x * channels;
+#ifdef OPENGL_CPP_MIP_CHAIN_SSE
+            if (channels == 4) {
+                auto sum = _mm_setzero_ps();
+                for (size_t tap = 0; tap < kernel.m_weights.size(); ++tap) {
+                    const auto sx = clamp_index(2 * x + tap, kernel.m_first, width);
+                    const auto w = _mm_set1_ps(kernel.m_weights[tap]);
+                    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(src_row + sx * 4), w));
+                }
+                _mm_storeu_ps(texel, sum);
+                continue;
+            }
+#endif
+            for (size_t tap = 0; tap < kernel.m_weights.size(); ++tap) {
+                const auto sx = clamp_index(2 * x + tap, kernel.m_first, width);
+                accumulate(texel, src_row + sx * channels, kernel.m_weights[tap], channels);
+            }
+        }
+    }
+    return dst;
+}
+
+std::vector<float> reduce_columns(const std::vector<float> &src, size_t width, size_t height, size_t channels,
+                                  const kernel_t &kernel) {
+    if (height == 1) {
+        return src;
+    }
+
+    // Whole rows are weighted at once, which vectorizes whatever the number of channels.
+    const auto row = width * channels;
+    const auto reduced = height / 2;
+    std::vector<float> dst(row * reduced);
+    for (size_t y = 0; y < reduced; ++y) {
+        for (size_t tap = 0; tap < kernel.m_weights.size(); ++tap) {
+            const auto sy = clamp_index(2 * y + tap, kernel.m_first, height);
+            accumulate(dst.data() + y * row, src.data() + sy * row, kernel.m_weights[tap], row);
+        }
+    }
+    return dst;
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+mip_chain_t::mip_chain_t(const mip_image_t &image, mip_filter_t filter, size_t levels)
+    : m_channels(image.m_channels), m_srgb(image.m_srgb) {
+    assert(image.m_pixels);
+    assert(0 < image.m_width && 0 < image.m_height);
+    assert(0 < m_channels && m_channels <= 4);
+    assert(!m_srgb || m_channels >= 3);
+
+    const auto full_levels = texture_t::get_full_levels(image.m_width, image.m_height);
+    levels = levels == 0 ? full_levels : levels;
+    assert(levels <= full_levels);
+    m_levels.reserve(levels);
+
+    // The base level is kept as is, and decoded to linear floats the other levels are reduced from.
+    auto width = image.m_width;
+    auto height = image.m_height;
+    auto stride = get_stride(width, m_channels);
+    m_levels.push_back({width, height, stride, std::vector<unsigned char>(stride * height)});
+    for (size_t y = 0; y < height; ++y) {
+        // The last row of the source does not need its padding.
+        std::copy_n(image.m_pixels + y * stride, width * m_channels, m_levels.front().m_data.data() + y * stride);
+    }
+
+    const auto &decode_colour = get_decode_table(m_srgb);
+    const auto &decode_alpha = get_decode_table(false);
+    std::vector<float> plane(width * height * m_channels);
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t i = 0; i < width * m_channels; ++i) {
+            const auto &decode = i % m_channels == alpha_channel ? decode_alpha : decode_colour;
+            plane[y * width * m_channels + i] = decode[image.m_pixels[y * stride + i]];
+        }
+    }
+
+    const auto kernel = make_kernel(filter);
+    while (m_levels.size() < levels) {
+        plane = reduce_rows(plane, width, height, m_channels, kernel);
+        width = std::max<size_t>(1, width / 2);
+        plane = reduce_columns(plane, width, height, m_channels, kernel);
+        height = std::max<size_t>(1, height / 2);
+
+        stride = get_stride(width, m_channels);
+        mip_level_t level{width, height, stride, std::vector<unsigned char>(stride * height)};
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t i = 0; i < width * m_channels; ++i) {
+                const auto srgb = m_srgb && i % m_channels != alpha_channel;
+                level.m_data[y * stride + i] = encode(plane[y * width * m_channels + i], srgb);
+            }
+        }
+        m_levels.push_back(std::move(level));
+    }
+}
+
+std::vector<mip_chain_t> mip_chain_t::build(const std::vector<mip_image_t> &images, mip_filter_t filter,
+                                            size_t levels, size_t threads) {
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, images.size());
+
+    std::vector<std::optional<mip_chain_t>> chains(images.size());
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    const auto work = [&] {
+        try {
+            for (auto i = next++; i < images.size(); i = next++) {
+                chains[i].emplace(images[i], filter, levels);
+            }
+        } catch (...) {
+            // The other threads stop taking images, and the first error is rethrown once they are all joined.
+            next = images.size();
+            const std::lock_guard lock(error_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    // The calling thread works too, instead of only waiting for the others.
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    std::vector<mip_chain_t> result;
+    result.reserve(chains.size());
+    for (auto &chain : chains) {
+        result.push_back(std::move(*chain));
+    }
+    return result;
+}
+
+void mip_chain_t::upload(texture_t &texture) const {
+    assert(texture.get_width() == m_levels.front().m_width);
+    assert(texture.get_height() == m_levels.front().m_height);
+
+    const auto levels = std::min(m_levels.size(), texture.get_levels());
+    for (size_t i = 0; i < levels; ++i) {
+        const auto &level = m_levels[i];
+        texture.set_sub_image(static_cast<int>(i), 0, 0, level.m_width, level.m_height, get_format(),
+                              level.m_data.data());
+    }
+}
+
+const mip_level_t &mip_chain_t::get_level(size_t level) const {
+    assert(level < m_levels.size());
+    return m_levels[level];
+}
+
+size_t mip_chain_t::get_levels() const {
+    return m_levels.size();
+}
+
+size_t mip_chain_t::get_channels() const {
+    return m_channels;
+}
+
+texture_format_t mip_chain_t::get_format() const {
+    switch (m_channels) {
+    case 1:
+        return texture_format_t::red;
+    case 2:
+        return texture_format_t::rg;
+    case 3:
+        return texture_format_t::rgb;
+    default:
+        return texture_format_t::rgba;
+    }
+}
+
+texture_internal_format_t mip_chain_t::get_internal_format() const {
+    switch (m_channels) {
+    case 1:
+        return texture_internal_format_t::r8;
+    case 2:
+        return texture_internal_format_t::rg8;
+    case 3:
+        return m_srgb ? texture_internal_format_t::srgb8 : texture_internal_format_t::rgb8;
+    default:
+        return m_srgb ? texture_internal_format_t::srgb8_alpha8 : texture_internal_format_t::rgba8;
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const mip_chain_t &c) {
+    return os << "mip_chain(" << &c << ") size=" << c.get_level(0).m_width << "x" << c.get_level(0).m_height
+              << ", levels=" << c.get_levels() << ", channels=" << c.get_channels();
+}
+
+} // namespace opengl_cpp
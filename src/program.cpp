@@ -5,13 +5,20 @@
 #include <cassert>
 #include <glad/glad.h>
 
+namespace {
+
+constexpr std::string_view array_suffix = "[0]";
+
+} // namespace
+
 namespace opengl_cpp {
 
 program_t::program_t(gl_t &gl) : m_gl(gl), m_id(m_gl.new_program()) {
 }
 
 program_t::program_t(program_t &&other) noexcept
-    : m_gl(other.m_gl), m_shaders(std::move(other.m_shaders)) {
+    : m_gl(other.m_gl), m_shaders(std::move(other.m_shaders)), m_uniform_names(std::move(other.m_uniform_names)),
+      m_uniform_locations(std::move(other.m_uniform_locations)) {
 
     if (m_id) {
         destroy();
@@ -27,6 +34,8 @@ program_t::~program_t() {
 
 program_t &program_t::operator=(program_t &&other) noexcept {
     this->m_shaders = std::move(other.m_shaders);
+    this->m_uniform_names = std::move(other.m_uniform_names);
+    this->m_uniform_locations = std::move(other.m_uniform_locations);
     if (m_id) {
         destroy();
     }
@@ -47,24 +56,79 @@ void program_t::add_shader(shader_t shader) {
 }
 
 void program_t::link() {
+    submit_link();
+    wait_link();
+}
+
+void program_t::submit_link() {
     assert(m_id);
 
     const auto err = m_gl.link(*this);
     if (error_t::no_error != err) {
         throw std::runtime_error("Error on program link: " + std::to_string(static_cast<int>(err)));
     }
+}
+
+bool program_t::is_link_ready() const {
+    assert(m_id);
+    return !m_gl.has_extension(extension_t::parallel_shader_compile) ||
+           GL_FALSE != m_gl.get_parameter(*this, program_parameter_t::completion_status);
+}
+
+void program_t::wait_link() {
+    assert(m_id);
 
     const auto success = m_gl.get_parameter(*this, program_parameter_t::link_status);
     if (GL_FALSE == success) {
+        for (auto &shader : m_shaders) {
+            shader.wait();
+        }
         throw std::runtime_error(m_gl.get_info_log(*this));
     }
 
     m_shaders.clear();
+    build_uniform_table();
+}
+
+void program_t::set_binary_retrievable() {
+    assert(m_id);
+    m_gl.set_parameter(*this, program_parameter_t::binary_retrievable_hint, GL_TRUE);
+}
+
+program_binary_t program_t::get_binary() const {
+    assert(m_id);
+    return m_gl.get_program_binary(*this);
+}
+
+bool program_t::load_binary(const program_binary_t &binary) {
+    assert(m_id);
+
+    if (m_gl.program_binary(*this, binary) != error_t::no_error ||
+        m_gl.get_parameter(*this, program_parameter_t::link_status) == GL_FALSE) {
+        return false;
+    }
+
+    m_shaders.clear();
+    build_uniform_table();
+    return true;
 }
 
 int program_t::get_uniform_location(const char *var_name) const {
     assert(m_id);
-    return m_gl.get_uniform_location(*this, var_name);
+
+    const std::lock_guard lock(m_uniform_mutex);
+    const auto it = m_uniform_locations.find(var_name);
+    if (it != m_uniform_locations.end()) {
+        return it->second;
+    }
+
+    const auto location = m_gl.get_uniform_location(*this, var_name);
+    add_uniform(var_name, location);
+    return location;
+}
+
+uniform_t program_t::get_uniform(const char *var_name) const {
+    return uniform_t(get_uniform_location(var_name));
 }
 
 void program_t::use() const {
@@ -76,6 +140,33 @@ const id_program_t &program_t::get_id() const {
     return m_id;
 }
 
+void program_t::add_uniform(std::string name, int location) const {
+    // Deque elements never move, so the views used as keys stay valid.
+    const auto &stored = m_uniform_names.emplace_back(std::move(name));
+    m_uniform_locations.emplace(stored, location);
+}
+
+void program_t::build_uniform_table() {
+    const std::lock_guard lock(m_uniform_mutex);
+    m_uniform_locations.clear();
+    m_uniform_names.clear();
+
+    const auto count = m_gl.get_parameter(*this, program_parameter_t::active_uniforms);
+    for (int i = 0; i < count; ++i) {
+        auto name = m_gl.get_active_uniform(*this, i);
+        // Uniform block members have no location, they are kept as -1 so they are not queried again.
+        const auto location = m_gl.get_uniform_location(*this, name.c_str());
+
+        // Arrays are listed as "arr[0]" but are usually addressed as "arr".
+        const std::string_view view = name;
+        if (view.size() > array_suffix.size() &&
+            view.substr(view.size() - array_suffix.size()) == array_suffix) {
+            add_uniform(name.substr(0, view.size() - array_suffix.size()), location);
+        }
+        add_uniform(std::move(name), location);
+    }
+}
+
 void program_t::destroy() {
     assert(m_id);
     m_gl.destroy(m_id);
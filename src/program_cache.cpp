@@ -0,0 +1,160 @@
+#include "program_cache.h"
+
+#include <array>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+constexpr std::array<char, 8> file_magic = {'O', 'G', 'L', 'C', 'P', 'P', 'B', '1'};
+
+constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+constexpr uint64_t fnv_prime = 1099511628211ULL;
+
+uint64_t fnv1a(uint64_t hash, const void *data, size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * fnv_prime;
+    }
+    return hash;
+}
+
+uint64_t fnv1a(uint64_t hash, const std::string &str) {
+    // The size is hashed too, so moving text from one string to the next changes the key.
+    const uint64_t size = str.size();
+    hash = fnv1a(hash, &size, sizeof(size));
+    return fnv1a(hash, str.data(), str.size());
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+program_cache_t::program_cache_t(gl_t &gl, std::filesystem::path directory)
+    : m_gl(gl), m_directory(std::move(directory)), m_enabled(m_gl.has_extension(extension_t::get_program_binary)) {
+
+    if (m_enabled) {
+        m_driver = m_gl.get_string(string_name_t::vendor) + '\n' + m_gl.get_string(string_name_t::renderer) + '\n' +
+                   m_gl.get_string(string_name_t::version);
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_directory, ec);
+    }
+}
+
+program_t program_cache_t::build(const std::vector<shader_source_t> &sources) {
+    std::filesystem::path path;
+    if (m_enabled) {
+        path = get_path(sources);
+        if (const auto binary = read(path)) {
+            program_t program(m_gl);
+            if (program.load_binary(*binary)) {
+                ++m_hits;
+                return program;
+            }
+        }
+    }
+
+    ++m_misses;
+    program_t program(m_gl);
+    for (const auto &source : sources) {
+        program.add_shader(shader_t(m_gl, source.m_type, source.m_source.c_str()));
+    }
+
+    if (m_enabled) {
+        program.set_binary_retrievable();
+    }
+    program.link();
+
+    if (m_enabled) {
+        const auto binary = program.get_binary();
+        if (!binary.m_data.empty()) {
+            write(path, binary);
+        }
+    }
+    return program;
+}
+
+const std::filesystem::path &program_cache_t::get_directory() const {
+    return m_directory;
+}
+
+size_t program_cache_t::get_hits() const {
+    return m_hits;
+}
+
+size_t program_cache_t::get_misses() const {
+    return m_misses;
+}
+
+std::filesystem::path program_cache_t::get_path(const std::vector<shader_source_t> &sources) const {
+    auto hash = fnv1a(fnv_offset_basis, m_driver);
+    for (const auto &source : sources) {
+        const auto type = static_cast<int>(source.m_type);
+        hash = fnv1a(hash, &type, sizeof(type));
+        hash = fnv1a(hash, source.m_source);
+    }
+
+    std::stringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hash << ".bin";
+    return m_directory / name.str();
+}
+
+std::optional<program_binary_t> program_cache_t::read(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+
+    std::array<char, file_magic.size()> magic{};
+    uint32_t format = 0;
+    file.read(magic.data(), magic.size());
+    file.read(reinterpret_cast<char *>(&format), sizeof(format)); // NOLINT(*-reinterpret-cast)
+    if (!file || magic != file_magic) {
+        return std::nullopt;
+    }
+
+    program_binary_t binary{format, {}};
+    const auto begin = file.tellg();
+    file.seekg(0, std::ios::end);
+    binary.m_data.resize(static_cast<size_t>(file.tellg() - begin));
+    file.seekg(begin);
+    file.read(reinterpret_cast<char *>(binary.m_data.data()), // NOLINT(*-reinterpret-cast)
+              static_cast<std::streamsize>(binary.m_data.size()));
+    if (!file || binary.m_data.empty()) {
+        return std::nullopt;
+    }
+    return binary;
+}
+
+void program_cache_t::write(const std::filesystem::path &path, const program_binary_t &binary) {
+    // Written aside then renamed, so a crash or a concurrent run never sees a truncated binary.
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            return;
+        }
+
+        const uint32_t format = binary.m_format;
+        file.write(file_magic.data(), file_magic.size());
+        file.write(reinterpret_cast<const char *>(&format), sizeof(format)); // NOLINT(*-reinterpret-cast)
+        file.write(reinterpret_cast<const char *>(binary.m_data.data()), // NOLINT(*-reinterpret-cast)
+                   static_cast<std::streamsize>(binary.m_data.size()));
+        if (!file) {
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+}
+
+std::ostream &operator<<(std::ostream &os, const program_cache_t &c) {
+    return os << "program_cache(" << &c << ") directory=" << c.get_directory() << ", hits=" << c.get_hits()
+              << ", misses=" << c.get_misses();
+}
+
+} // namespace opengl_cpp
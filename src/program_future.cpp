@@ -0,0 +1,38 @@
+#include "program_future.h"
+
+#include <cassert>
+
+namespace opengl_cpp {
+
+program_future_t::program_future_t(gl_t &gl, const std::vector<shader_source_t> &sources) : m_program(gl) {
+    for (const auto &source : sources) {
+        shader_t shader(gl, source.m_type);
+        shader.submit(source.m_source.c_str());
+        m_program->add_shader(std::move(shader));
+    }
+    m_program->submit_link();
+}
+
+bool program_future_t::is_ready() const {
+    assert(m_program);
+    return m_program->is_link_ready();
+}
+
+program_t program_future_t::get() {
+    assert(m_program);
+
+    m_program->wait_link();
+    auto program = std::move(*m_program);
+    m_program.reset();
+    return program;
+}
+
+bool program_future_t::is_valid() const {
+    return m_program.has_value();
+}
+
+std::ostream &operator<<(std::ostream &os, const program_future_t &f) {
+    return os << "program_future(" << &f << ") valid=" << f.is_valid();
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,156 @@
+#include "quantized_vertex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+using opengl_cpp::half_t;
+
+constexpr float position_max = std::numeric_limits<uint16_t>::max();
+constexpr float normal_max = std::numeric_limits<int16_t>::max();
+
+std::array<uint16_t, 4> quantize_position(const glm::vec3 &pos, const glm::vec3 &min, const glm::vec3 &scale) {
+    std::array<uint16_t, 4> q{};
+    for (int i = 0; i < 3; ++i) {
+        const auto v = std::clamp((pos[i] - min[i]) * scale[i] + 0.5F, 0.0F, position_max);
+        q[i] = static_cast<uint16_t>(v);
+    }
+    return q;
+}
+
+// Projects the normal on the octahedron |x| + |y| + |z| = 1, then folds the lower half over the upper one.
+std::array<int16_t, 2> encode_normal(const glm::vec3 &n) {
+    const auto length = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    if (length == 0.0F) {
+        return {0, 0};
+    }
+
+    auto x = n.x / length;
+    auto y = n.y / length;
+    if (n.z < 0.0F) {
+        const auto folded_x = (1.0F - std::abs(y)) * (x >= 0.0F ? 1.0F : -1.0F);
+        const auto folded_y = (1.0F - std::abs(x)) * (y >= 0.0F ? 1.0F : -1.0F);
+        x = folded_x;
+        y = folded_y;
+    }
+    return {static_cast<int16_t>(std::lround(std::clamp(x, -1.0F, 1.0F) * normal_max)),
+            static_cast<int16_t>(std::lround(std::clamp(y, -1.0F, 1.0F) * normal_max))};
+}
+
+glm::vec3 decode_normal(const std::array<int16_t, 2> &q) {
+    const auto x = std::max(q[0] / normal_max, -1.0F);
+    const auto y = std::max(q[1] / normal_max, -1.0F);
+    glm::vec3 n(x, y, 1.0F - std::abs(x) - std::abs(y));
+    const auto t = std::max(-n.z, 0.0F);
+    n.x += n.x >= 0.0F ? -t : t;
+    n.y += n.y >= 0.0F ? -t : t;
+    const auto length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+    return {n.x / length, n.y / length, n.z / length};
+}
+
+std::array<half_t, 2> encode_tex(const glm::vec2 &tex) {
+    return {opengl_cpp::to_half(tex.x), opengl_cpp::to_half(tex.y)};
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+quantized_mesh_t quantize(const std::vector<vertex_t> &vertices) {
+    quantized_mesh_t mesh{{}, glm::vec3(0.0F), glm::vec3(0.0F)};
+    if (vertices.empty()) {
+        return mesh;
+    }
+
+    auto min = vertices.front().m_pos;
+    auto max = min;
+    for (const auto &v : vertices) {
+        for (int i = 0; i < 3; ++i) {
+            min[i] = std::min(min[i], v.m_pos[i]);
+            max[i] = std::max(max[i], v.m_pos[i]);
+        }
+    }
+
+    // Flat axes are all at the minimum, with a zero scale instead of a division by zero.
+    glm::vec3 extent(0.0F);
+    glm::vec3 scale(0.0F);
+    for (int i = 0; i < 3; ++i) {
+        extent[i] = max[i] - min[i];
+        scale[i] = extent[i] > 0.0F ? position_max / extent[i] : 0.0F;
+    }
+
+    mesh.m_bounds_min = min;
+    mesh.m_bounds_extent = extent;
+    mesh.m_vertices.reserve(vertices.size());
+    for (const auto &v : vertices) {
+        mesh.m_vertices.push_back(
+            {quantize_position(v.m_pos, min, scale), encode_normal(v.m_nor), encode_tex(v.m_tex)});
+    }
+    return mesh;
+}
+
+std::vector<vertex_t> dequantize(const quantized_mesh_t &mesh) {
+    std::vector<vertex_t> vertices;
+    vertices.reserve(mesh.m_vertices.size());
+    for (const auto &q : mesh.m_vertices) {
+        vertex_t v{};
+        for (int i = 0; i < 3; ++i) {
+            v.m_pos[i] = mesh.m_bounds_min[i] + q.m_pos[i] / position_max * mesh.m_bounds_extent[i];
+        }
+        v.m_tex = glm::vec2(to_float(q.m_tex[0]), to_float(q.m_tex[1]));
+        v.m_nor = decode_normal(q.m_nor);
+        vertices.push_back(v);
+    }
+    return vertices;
+}
+
+half_t to_half(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    bits &= 0x7FFFFFFF;
+
+    constexpr uint32_t infinity = 0x7F800000;
+    constexpr uint32_t half_overflow = 0x477FF000; // 65520, rounds up past the largest half.
+    constexpr uint32_t half_normal_min = 0x38800000;
+    if (bits >= infinity) {
+        return {static_cast<uint16_t>(sign | 0x7C00 | (bits > infinity ? 0x200 : 0))};
+    }
+    if (bits >= half_overflow) {
+        return {static_cast<uint16_t>(sign | 0x7C00)};
+    }
+    if (bits < half_normal_min) {
+        // Subnormal halves count units of 2^-24, the default rounding mode rounds to nearest even.
+        const auto units = std::nearbyint(std::abs(value) * 16777216.0F);
+        return {static_cast<uint16_t>(sign | static_cast<uint16_t>(units))};
+    }
+
+    // Rebias the exponent from 127 to 15 and drop the 13 lowest mantissa bits, rounding to nearest even.
+    auto half = (bits - 0x38000000) >> 13;
+    const auto rest = bits & 0x1FFF;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1) != 0)) {
+        ++half;
+    }
+    return {static_cast<uint16_t>(sign | half)};
+}
+
+float to_float(half_t value) {
+    const uint32_t sign = (value.m_bits & 0x8000U) << 16;
+    const uint32_t exponent = (value.m_bits >> 10) & 0x1F;
+    const uint32_t mantissa = value.m_bits & 0x3FF;
+    if (exponent == 0) {
+        const auto magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign != 0 ? -magnitude : magnitude;
+    }
+
+    uint32_t bits = sign | (mantissa << 13);
+    bits |= exponent == 0x1F ? 0x7F800000 : (exponent + 112) << 23;
+    float result = 0.0F;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,195 @@
+#include "rect_packer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <tuple>
+
+namespace {
+
+using opengl_cpp::rect_t;
+
+bool intersects(const rect_t &a, const rect_t &b) {
+    return a.m_x < b.m_x + b.m_width && b.m_x < a.m_x + a.m_width && a.m_y < b.m_y + b.m_height &&
+           b.m_y < a.m_y + a.m_height;
+}
+
+bool contains(const rect_t &outer, const rect_t &inner) {
+    return outer.m_x <= inner.m_x && outer.m_y <= inner.m_y &&
+           inner.m_x + inner.m_width <= outer.m_x + outer.m_width &&
+           inner.m_y + inner.m_height <= outer.m_y + outer.m_height;
+}
+
+// Joins two rectangles sharing a whole edge into one, if they do.
+std::optional<rect_t> join(const rect_t &a, const rect_t &b) {
+    if (a.m_x == b.m_x && a.m_width == b.m_width) {
+        if (a.m_y + a.m_height == b.m_y) {
+            return rect_t{a.m_x, a.m_y, a.m_width, a.m_height + b.m_height};
+        }
+        if (b.m_y + b.m_height == a.m_y) {
+            return rect_t{a.m_x, b.m_y, a.m_width, a.m_height + b.m_height};
+        }
+    }
+    if (a.m_y == b.m_y && a.m_height == b.m_height) {
+        if (a.m_x + a.m_width == b.m_x) {
+            return rect_t{a.m_x, a.m_y, a.m_width + b.m_width, a.m_height};
+        }
+        if (b.m_x + b.m_width == a.m_x) {
+            return rect_t{b.m_x, a.m_y, a.m_width + b.m_width, a.m_height};
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+bool operator==(const rect_t &a, const rect_t &b) {
+    return std::tie(a.m_x, a.m_y, a.m_width, a.m_height) == std::tie(b.m_x, b.m_y, b.m_width, b.m_height);
+}
+
+rect_packer_t::rect_packer_t(size_t width, size_t height) : m_width(width), m_height(height) {
+    assert(width > 0 && height > 0);
+    clear();
+}
+
+std::optional<rect_t> rect_packer_t::insert(size_t width, size_t height) {
+    assert(width > 0 && height > 0);
+
+    // Best short side fit: the free rectangle leaving the smallest leftover on its tighter side wins.
+    constexpr auto worst = std::numeric_limits<size_t>::max();
+    auto best_short = worst;
+    auto best_long = worst;
+    std::optional<rect_t> best;
+    for (const auto &free : m_free) {
+        if (free.m_width < width || free.m_height < height) {
+            continue;
+        }
+
+        const auto leftover_x = free.m_width - width;
+        const auto leftover_y = free.m_height - height;
+        const auto leftover_short = std::min(leftover_x, leftover_y);
+        const auto leftover_long = std::max(leftover_x, leftover_y);
+        if (std::tie(leftover_short, leftover_long) < std::tie(best_short, best_long)) {
+            best_short = leftover_short;
+            best_long = leftover_long;
+            best = rect_t{free.m_x, free.m_y, width, height};
+        }
+    }
+
+    if (best) {
+        split_free_rects(*best);
+        prune_free_rects();
+        m_used_area += width * height;
+    }
+    return best;
+}
+
+void rect_packer_t::remove(const rect_t &rect) {
+    assert(rect.m_x + rect.m_width <= m_width && rect.m_y + rect.m_height <= m_height);
+    assert(m_used_area >= rect.m_width * rect.m_height);
+
+    m_used_area -= rect.m_width * rect.m_height;
+    if (m_used_area == 0) {
+        clear();
+        return;
+    }
+
+    m_free.push_back(rect);
+    merge_free_rects();
+    prune_free_rects();
+}
+
+void rect_packer_t::clear() {
+    m_used_area = 0;
+    m_free.assign(1, rect_t{0, 0, m_width, m_height});
+}
+
+size_t rect_packer_t::get_width() const {
+    return m_width;
+}
+
+size_t rect_packer_t::get_height() const {
+    return m_height;
+}
+
+size_t rect_packer_t::get_used_area() const {
+    return m_used_area;
+}
+
+const std::vector<rect_t> &rect_packer_t::get_free_rects() const {
+    return m_free;
+}
+
+void rect_packer_t::split_free_rects(const rect_t &used) {
+    std::vector<rect_t> split;
+    for (auto it = m_free.begin(); it != m_free.end();) {
+        if (!intersects(*it, used)) {
+            ++it;
+            continue;
+        }
+
+        // Up to four maximal rectangles remain around the used one: left, right, below and above.
+        const auto free = *it;
+        if (used.m_x > free.m_x) {
+            split.push_back({free.m_x, free.m_y, used.m_x - free.m_x, free.m_height});
+        }
+        if (used.m_x + used.m_width < free.m_x + free.m_width) {
+            const auto x = used.m_x + used.m_width;
+            split.push_back({x, free.m_y, free.m_x + free.m_width - x, free.m_height});
+        }
+        if (used.m_y > free.m_y) {
+            split.push_back({free.m_x, free.m_y, free.m_width, used.m_y - free.m_y});
+        }
+        if (used.m_y + used.m_height < free.m_y + free.m_height) {
+            const auto y = used.m_y + used.m_height;
+            split.push_back({free.m_x, y, free.m_width, free.m_y + free.m_height - y});
+        }
+        it = m_free.erase(it);
+    }
+    m_free.insert(m_free.end(), split.begin(), split.end());
+}
+
+void rect_packer_t::merge_free_rects() {
+    // Freed rectangles are only added back as they were, so glue the neighbours sharing an edge to limit fragmentation.
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (size_t i = 0; i < m_free.size() && !merged; ++i) {
+            for (size_t j = i + 1; j < m_free.size() && !merged; ++j) {
+                if (const auto joined = join(m_free[i], m_free[j])) {
+                    m_free[i] = *joined;
+                    m_free.erase(m_free.begin() + static_cast<std::ptrdiff_t>(j));
+                    merged = true;
+                }
+            }
+        }
+    }
+}
+
+void rect_packer_t::prune_free_rects() {
+    for (size_t i = 0; i < m_free.size(); ++i) {
+        for (size_t j = i + 1; j < m_free.size();) {
+            if (contains(m_free[i], m_free[j])) {
+                m_free.erase(m_free.begin() + static_cast<std::ptrdiff_t>(j));
+            } else if (contains(m_free[j], m_free[i])) {
+                m_free.erase(m_free.begin() + static_cast<std::ptrdiff_t>(i));
+                j = i + 1;
+            } else {
+                ++j;
+            }
+        }
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const rect_t &r) {
+    return os << "rect(" << r.m_x << ", " << r.m_y << ", " << r.m_width << ", " << r.m_height << ")";
+}
+
+std::ostream &operator<<(std::ostream &os, const rect_packer_t &p) {
+    return os << "rect_packer(" << &p << ") size=" << p.get_width() << "x" << p.get_height()
+              << ", used_area=" << p.get_used_area() << ", free_rects=" << p.get_free_rects().size();
+}
+
+} // namespace opengl_cpp
@@ -1,8 +1,7 @@
 #include "shader.h"
+#include "mapped_file.h"
 
-#include <array>
 #include <cassert>
-#include <fstream>
 #include <glad/glad.h>
 
 namespace opengl_cpp {
@@ -14,18 +13,23 @@ shader_t::shader_t(gl_t &gl, shader_type_t type, const char *source) : m_gl(gl),
 }
 
 shader_t::shader_t(gl_t &gl, shader_type_t type, const std::filesystem::path &shader_path) : m_gl(gl) {
-    std::ifstream shader_file(shader_path);
-    if (!shader_file.is_open()) {
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(shader_path, ec)) {
         throw std::runtime_error("shader file not found: " + shader_path.string());
     }
 
-    std::stringstream shader_stream;
-    shader_stream << shader_file.rdbuf();
-
-    std::string code = shader_stream.str();
+    // The driver copies the source, so the mapping is only needed while setting it.
+    const mapped_file_t file(shader_path);
 
     m_id = m_gl.new_shader(type);
-    compile(code.c_str());
+    submit({file.get_view()});
+    wait();
+}
+
+shader_t::shader_t(gl_t &gl, shader_type_t type, const std::vector<std::string_view> &sources)
+    : m_gl(gl), m_id(gl.new_shader(type)) {
+    submit(sources);
+    wait();
 }
 
 shader_t::shader_t(shader_t &&other) noexcept : m_gl(other.m_gl) {
@@ -53,33 +57,63 @@ const id_shader_t &shader_t::get_id() const {
     return m_id;
 }
 
-void shader_t::compile(const char *source) {
+void shader_t::submit(const char *source) {
     assert(nullptr != source);
     assert(m_id);
 
-    m_gl.set_sources(*this, 1, &source);
+    m_gl.set_sources(*this, 1, &source, nullptr);
+    start_compile();
+}
 
-    std::string error_message;
+void shader_t::submit(const std::vector<std::string_view> &sources) {
+    assert(m_id);
 
+    std::vector<const char *> strings;
+    std::vector<int> lengths;
+    strings.reserve(sources.size());
+    lengths.reserve(sources.size());
+    for (const auto &source : sources) {
+        strings.push_back(source.data());
+        lengths.push_back(static_cast<int>(source.size()));
+    }
+
+    m_gl.set_sources(*this, strings.size(), strings.data(), lengths.data());
+    start_compile();
+}
+
+void shader_t::start_compile() {
     const auto err = m_gl.compile(*this);
-    if (error_t::no_error == err) {
-        const auto success = m_gl.get_parameter(*this, shader_parameter_t::compile_status);
-        if (GL_FALSE == success) {
-            error_message = m_gl.get_info_log(*this);
-            if (error_message.empty()) {
-                error_message = "Shader compilation failed with unspecified error";
-            }
-        }
-    } else {
-        error_message = "Error compiling shader: " + to_string(err);
+    if (error_t::no_error != err) {
+        destroy();
+        throw std::runtime_error("Error compiling shader: " + to_string(err));
     }
+}
+
+bool shader_t::is_ready() const {
+    assert(m_id);
+    return !m_gl.has_extension(extension_t::parallel_shader_compile) ||
+           GL_FALSE != m_gl.get_parameter(*this, shader_parameter_t::completion_status);
+}
 
-    if (!error_message.empty()) {
+void shader_t::wait() {
+    assert(m_id);
+
+    const auto success = m_gl.get_parameter(*this, shader_parameter_t::compile_status);
+    if (GL_FALSE == success) {
+        auto error_message = m_gl.get_info_log(*this);
+        if (error_message.empty()) {
+            error_message = "Shader compilation failed with unspecified error";
+        }
         destroy();
         throw std::runtime_error(error_message);
     }
 }
 
+void shader_t::compile(const char *source) {
+    submit(source);
+    wait();
+}
+
 void shader_t::destroy() {
     assert(m_id);
     m_gl.destroy(m_id);
@@ -0,0 +1,194 @@
+#include "shader_library.h"
+
+#include <stdexcept>
+
+namespace {
+
+constexpr std::string_view newline = "\n";
+
+bool is_blank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+// Parses `#include "name"` or `#include <name>`, with optional blanks around the tokens. end is set past the name.
+bool parse_include(std::string_view line, std::string &name, size_t &end) {
+    size_t pos = 0;
+    const auto skip_blanks = [&] {
+        while (pos < line.size() && is_blank(line[pos])) {
+            ++pos;
+        }
+    };
+
+    skip_blanks();
+    if (pos == line.size() || line[pos] != '#') {
+        return false;
+    }
+    ++pos;
+    skip_blanks();
+
+    constexpr std::string_view directive = "include";
+    if (line.substr(pos, directive.size()) != directive) {
+        return false;
+    }
+    pos += directive.size();
+    skip_blanks();
+
+    if (pos == line.size() || (line[pos] != '"' && line[pos] != '<')) {
+        return false;
+    }
+    const char close = line[pos] == '"' ? '"' : '>';
+    const auto close_pos = line.find(close, pos + 1);
+    if (close_pos == std::string_view::npos || close_pos == pos + 1) {
+        return false;
+    }
+
+    name = line.substr(pos + 1, close_pos - pos - 1);
+    end = close_pos + 1;
+    return true;
+}
+
+// Tells whether a line starting inside a block comment, or not, ends inside one.
+bool ends_in_comment(std::string_view line, bool in_comment) {
+    for (size_t pos = 0; pos + 1 < line.size(); ++pos) {
+        const auto token = line.substr(pos, 2);
+        if (in_comment && token == "*/") {
+            in_comment = false;
+            ++pos;
+        } else if (!in_comment && token == "//") {
+            return false;
+        } else if (!in_comment && token == "/*") {
+            in_comment = true;
+            ++pos;
+        }
+    }
+    return in_comment;
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+shader_library_t::shader_library_t(std::vector<std::filesystem::path> include_dirs)
+    : m_include_dirs(std::move(include_dirs)) {
+}
+
+const std::vector<std::string_view> &shader_library_t::get_sources(const std::filesystem::path &path) {
+    const auto key = std::filesystem::weakly_canonical(path).string();
+    const auto it = m_sources.find(key);
+    if (it != m_sources.end()) {
+        return it->second;
+    }
+
+    std::vector<std::string_view> sources;
+    std::unordered_set<std::string> included;
+    resolve(get_file(key), key, sources, included);
+    return m_sources.emplace(key, std::move(sources)).first->second;
+}
+
+shader_t shader_library_t::load(gl_t &gl, shader_type_t type, const std::filesystem::path &path) {
+    return shader_t(gl, type, get_sources(path));
+}
+
+void shader_library_t::clear() {
+    m_sources.clear();
+    m_files.clear();
+}
+
+size_t shader_library_t::get_file_count() const {
+    return m_files.size();
+}
+
+const shader_library_t::file_t &shader_library_t::get_file(const std::filesystem::path &path) {
+    const auto key = path.string();
+    const auto it = m_files.find(key);
+    if (it != m_files.end()) {
+        return it->second;
+    }
+
+    file_t file{mapped_file_t(path), path.parent_path(), {}};
+    const auto text = file.m_mapping.get_view();
+
+    size_t segment_begin = 0;
+    size_t line_begin = 0;
+    bool in_comment = false;
+    std::string name;
+    size_t name_end = 0;
+    while (line_begin < text.size()) {
+        auto line_end = text.find('\n', line_begin);
+        line_end = line_end == std::string_view::npos ? text.size() : line_end + 1;
+        const auto line = text.substr(line_begin, line_end - line_begin);
+
+        // Directives commented out by a block comment are left in the text, the compiler ignores them.
+        if (!in_comment && parse_include(line, name, name_end)) {
+            if (line_begin > segment_begin) {
+                file.m_segments.push_back({text.substr(segment_begin, line_begin - segment_begin), {}});
+            }
+            file.m_segments.push_back({{}, name});
+            segment_begin = line_end;
+
+            // Keep a block comment opened after the directive, or the lines it comments out would be compiled.
+            const auto tail = line.substr(name_end);
+            if (ends_in_comment(tail, false)) {
+                file.m_segments.push_back({tail, {}});
+                in_comment = true;
+            }
+        } else {
+            in_comment = ends_in_comment(line, in_comment);
+        }
+        line_begin = line_end;
+    }
+
+    if (segment_begin < text.size()) {
+        file.m_segments.push_back({text.substr(segment_begin), {}});
+    }
+
+    // A file not ending with a new line would glue its last line to the text following its include directive.
+    if (!text.empty() && text.back() != '\n') {
+        file.m_segments.push_back({newline, {}});
+    }
+
+    return m_files.emplace(key, std::move(file)).first->second;
+}
+
+std::filesystem::path shader_library_t::find_include(const std::string &name,
+                                                     const std::filesystem::path &from) const {
+    std::error_code ec;
+    auto candidate = from / name;
+    if (std::filesystem::is_regular_file(candidate, ec)) {
+        return std::filesystem::weakly_canonical(candidate);
+    }
+
+    for (const auto &dir : m_include_dirs) {
+        candidate = dir / name;
+        if (std::filesystem::is_regular_file(candidate, ec)) {
+            return std::filesystem::weakly_canonical(candidate);
+        }
+    }
+    return {};
+}
+
+void shader_library_t::resolve(const file_t &file, const std::filesystem::path &path,
+                               std::vector<std::string_view> &sources, std::unordered_set<std::string> &included) {
+    included.insert(path.string());
+
+    for (const auto &segment : file.m_segments) {
+        if (segment.m_include.empty()) {
+            sources.push_back(segment.m_text);
+            continue;
+        }
+
+        const auto include_path = find_include(segment.m_include, file.m_directory);
+        if (include_path.empty()) {
+            throw std::runtime_error("shader include not found: " + segment.m_include + " from " + path.string());
+        }
+        if (included.count(include_path.string()) == 0) {
+            resolve(get_file(include_path), include_path, sources, included);
+        }
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const shader_library_t &l) {
+    return os << "shader_library(" << &l << ") files=" << l.get_file_count();
+}
+
+} // namespace opengl_cpp
@@ -0,0 +1,106 @@
+#include "stream_buffer.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint64_t wait_timeout_ns = 1000000;
+
+size_t align_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+stream_buffer_t::stream_buffer_t(gl_t &gl, buffer_target_t target, size_t frame_size)
+    : m_gl(gl), m_buffer(gl, 0, target), m_frame_size(frame_size) {
+    assert(frame_size > 0);
+
+    m_mapped = static_cast<std::byte *>(m_buffer.allocate_persistent(m_frame_size * frame_count));
+}
+
+stream_buffer_t::stream_buffer_t(stream_buffer_t &&other) noexcept
+    : m_gl(other.m_gl), m_buffer(std::move(other.m_buffer)), m_frame_size(other.m_frame_size),
+      m_mapped(other.m_mapped), m_frame(other.m_frame), m_offset(other.m_offset), m_fences(other.m_fences) {
+    other.m_mapped = nullptr;
+    other.m_fences.fill(nullptr);
+}
+
+stream_buffer_t::~stream_buffer_t() {
+    for (auto *fence : m_fences) {
+        if (fence != nullptr) {
+            m_gl.destroy(fence);
+        }
+    }
+    // Deleting the buffer releases the persistent mapping, no need to bind it to unmap.
+}
+
+void stream_buffer_t::bind() {
+    m_buffer.bind();
+}
+
+stream_allocation_t stream_buffer_t::allocate(size_t size, size_t alignment) {
+    assert(m_mapped);
+    assert(alignment > 0);
+
+    const auto frame_begin = m_frame * m_frame_size;
+    const auto offset = align_up(frame_begin + m_offset, alignment);
+    if (offset + size > frame_begin + m_frame_size) {
+        throw std::length_error("stream_buffer_t frame exhausted: " + std::to_string(size) + " bytes requested, " +
+                                std::to_string(m_frame_size - m_offset) + " left");
+    }
+
+    m_offset = offset + size - frame_begin;
+    return {m_mapped + offset, offset, size};
+}
+
+void stream_buffer_t::end_frame() {
+    assert(m_mapped);
+    assert(m_fences[m_frame] == nullptr);
+
+    m_fences[m_frame] = m_gl.fence_sync();
+    m_frame = (m_frame + 1) % frame_count;
+    m_offset = 0;
+    wait(m_frame);
+}
+
+const buffer_t &stream_buffer_t::get_buffer() const {
+    return m_buffer;
+}
+
+size_t stream_buffer_t::get_frame_size() const {
+    return m_frame_size;
+}
+
+size_t stream_buffer_t::get_frame() const {
+    return m_frame;
+}
+
+void stream_buffer_t::wait(size_t frame) {
+    auto &fence = m_fences[frame];
+    if (fence == nullptr) {
+        return;
+    }
+
+    auto status = sync_status_t::timeout_expired;
+    while (status == sync_status_t::timeout_expired) {
+        status = m_gl.client_wait_sync(fence, wait_timeout_ns);
+    }
+
+    m_gl.destroy(fence);
+    fence = nullptr;
+
+    if (status == sync_status_t::wait_failed) {
+        throw std::runtime_error("stream_buffer_t failed waiting for the GPU");
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const stream_buffer_t &b) {
+    return os << "stream_buffer(" << &b << ") buffer=" << b.get_buffer().get_id()
+              << ", frame_size=" << b.get_frame_size() << ", frame=" << b.get_frame();
+}
+
+} // namespace opengl_cpp
@@ -1,9 +1,13 @@
 #include "texture.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace {
 
 constexpr auto null_id = 0;
 constexpr auto null_unit = -1;
+constexpr size_t block_size = 4;
 
 } // namespace
 
@@ -28,6 +32,11 @@ texture_t::texture_t(texture_t &&other) noexcept : m_gl(other.m_gl) {
     other.m_target = texture_target_t::undefined;
     m_unit = other.m_unit;
     other.m_unit = null_unit;
+    m_width = other.m_width;
+    m_height = other.m_height;
+    m_levels = other.m_levels;
+    m_layers = other.m_layers;
+    m_internal_format = other.m_internal_format;
 }
 
 texture_t::~texture_t() {
@@ -46,6 +55,11 @@ texture_t &texture_t::operator=(texture_t &&other) noexcept {
     other.m_target = texture_target_t::undefined;
     m_unit = other.m_unit;
     other.m_unit = null_unit;
+    m_width = other.m_width;
+    m_height = other.m_height;
+    m_levels = other.m_levels;
+    m_layers = other.m_layers;
+    m_internal_format = other.m_internal_format;
     return *this;
 }
 
@@ -58,11 +72,98 @@ void texture_t::bind() {
     m_gl.bind(*this);
 }
 
+void texture_t::allocate(size_t width, size_t height, texture_internal_format_t format, size_t levels) {
+    assert(m_id);
+    assert(texture_target_t::tex_2d == m_target);
+    assert(0 < levels && levels <= get_full_levels(width, height));
+
+    if (m_levels != 0) {
+        throw std::logic_error("texture storage is immutable and was already allocated");
+    }
+
+    m_gl.texture_storage(*this, levels, format, width, height);
+    m_width = width;
+    m_height = height;
+    m_levels = levels;
+    m_layers = 1;
+    m_internal_format = format;
+}
+
+void texture_t::allocate_array(size_t width, size_t height, size_t layers, texture_internal_format_t format,
+                               size_t levels) {
+    assert(m_id);
+    assert(texture_target_t::tex_2d_array == m_target);
+    assert(0 < layers);
+    assert(0 < levels && levels <= get_full_levels(width, height));
+
+    if (m_levels != 0) {
+        throw std::logic_error("texture storage is immutable and was already allocated");
+    }
+
+    m_gl.texture_storage_3d(*this, levels, format, width, height, layers);
+    m_width = width;
+    m_height = height;
+    m_levels = levels;
+    m_layers = layers;
+    m_internal_format = format;
+}
+
 void texture_t::set_image(size_t width, size_t height, texture_format_t format, const unsigned char *data) {
     assert(m_id);
-    assert(texture_target_t::undefined != m_target);
+    assert(texture_target_t::tex_2d == m_target);
+    assert(m_levels == 0);
+
+    m_gl.set_image(*this, width, height, format, data);
+}
+
+void texture_t::set_sub_image(int level, size_t x, size_t y, size_t width, size_t height, texture_format_t format,
+                              const void *data, pixel_type_t type) {
+    assert(m_id);
+    assert(texture_target_t::tex_2d == m_target);
+    assert(0 <= level);
+    assert(m_levels == 0 || static_cast<size_t>(level) < m_levels);
+    assert(m_levels == 0 || x + width <= std::max<size_t>(1, m_width >> level));
+    assert(m_levels == 0 || y + height <= std::max<size_t>(1, m_height >> level));
+
+    m_gl.set_sub_image(*this, level, x, y, width, height, format, type, data);
+}
+
+void texture_t::set_layer_image(size_t layer, int level, size_t x, size_t y, size_t width, size_t height,
+                                texture_format_t format, const void *data, pixel_type_t type) {
+    assert(m_id);
+    assert(texture_target_t::tex_2d_array == m_target);
+    assert(layer < m_layers);
+    assert(0 <= level && static_cast<size_t>(level) < m_levels);
+    assert(x + width <= std::max<size_t>(1, m_width >> level));
+    assert(y + height <= std::max<size_t>(1, m_height >> level));
+
+    m_gl.set_sub_image_3d(*this, level, x, y, layer, width, height, 1, format, type, data);
+}
+
+void texture_t::set_compressed_image(int level, size_t width, size_t height, texture_internal_format_t format,
+                                     size_t size, const void *data) {
+    assert(m_id);
+    assert(texture_target_t::tex_2d == m_target);
+    assert(m_levels == 0);
+    assert(0 <= level);
+    assert(is_compressed(format));
+    assert(size == get_compressed_size(format, width, height));
 
-    m_gl.set_image(width, height, format, data);
+    m_gl.compressed_image(*this, level, format, width, height, size, data);
+}
+
+void texture_t::set_compressed_sub_image(int level, size_t x, size_t y, size_t width, size_t height, size_t size,
+                                         const void *data) {
+    assert(m_id);
+    assert(texture_target_t::tex_2d == m_target);
+    assert(is_compressed(m_internal_format));
+    assert(0 <= level && static_cast<size_t>(level) < m_levels);
+    assert(x % block_size == 0 && y % block_size == 0);
+    assert(x + width <= std::max<size_t>(1, m_width >> level));
+    assert(y + height <= std::max<size_t>(1, m_height >> level));
+    assert(size == get_compressed_size(m_internal_format, width, height));
+
+    m_gl.compressed_sub_image(*this, level, x, y, width, height, m_internal_format, size, data);
 }
 
 void texture_t::generate_mipmap() {
@@ -83,12 +184,85 @@ int texture_t::get_unit() const {
     return m_unit;
 }
 
+size_t texture_t::get_width() const {
+    return m_width;
+}
+
+size_t texture_t::get_height() const {
+    return m_height;
+}
+
+size_t texture_t::get_levels() const {
+    return m_levels;
+}
+
+size_t texture_t::get_layers() const {
+    return m_layers;
+}
+
+texture_internal_format_t texture_t::get_internal_format() const {
+    return m_internal_format;
+}
+
+size_t texture_t::get_full_levels(size_t width, size_t height) {
+    size_t levels = 1;
+    for (auto size = std::max(width, height); size > 1; size /= 2) {
+        ++levels;
+    }
+    return levels;
+}
+
+bool texture_t::is_compressed(texture_internal_format_t format) {
+    switch (format) {
+    case texture_internal_format_t::bc1_rgb:
+    case texture_internal_format_t::bc1_rgba:
+    case texture_internal_format_t::bc3_rgba:
+    case texture_internal_format_t::bc4_r:
+    case texture_internal_format_t::bc5_rg:
+    case texture_internal_format_t::bc7_rgba:
+    case texture_internal_format_t::bc7_srgb_alpha:
+    case texture_internal_format_t::etc2_rgb8:
+    case texture_internal_format_t::etc2_srgb8:
+    case texture_internal_format_t::etc2_rgba8:
+    case texture_internal_format_t::etc2_srgb8_alpha8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t texture_t::get_compressed_size(texture_internal_format_t format, size_t width, size_t height) {
+    assert(is_compressed(format));
+
+    // BC1, BC4 and the ETC2 formats without alpha pack a block of 4x4 texels in 8 bytes, the others in 16.
+    size_t block_bytes = 16;
+    switch (format) {
+    case texture_internal_format_t::bc1_rgb:
+    case texture_internal_format_t::bc1_rgba:
+    case texture_internal_format_t::bc4_r:
+    case texture_internal_format_t::etc2_rgb8:
+    case texture_internal_format_t::etc2_srgb8:
+        block_bytes = 8;
+        break;
+    default:
+        break;
+    }
+    const auto blocks_x = (width + block_size - 1) / block_size;
+    const auto blocks_y = (height + block_size - 1) / block_size;
+    return blocks_x * blocks_y * block_bytes;
+}
+
 void texture_t::destroy() {
     assert(m_id);
     m_gl.destroy(1, &m_id);
     m_id = null_id;
     m_target = texture_target_t::undefined;
     m_unit = null_unit;
+    m_width = 0;
+    m_height = 0;
+    m_levels = 0;
+    m_layers = 0;
+    m_internal_format = texture_internal_format_t::undefined;
 }
 
 std::ostream &operator<<(std::ostream &os, const texture_t &t) {
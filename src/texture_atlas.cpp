@@ -0,0 +1,131 @@
+#include "texture_atlas.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// Copies an image into the middle of a larger one, repeating its edge texels over the padding around it. Rows of both
+// images are aligned to 4 bytes.
+void extrude(const std::byte *image, size_t width, size_t height, size_t pixel_size, size_t padding,
+             std::vector<std::byte> &padded) {
+    const auto image_stride = (width * pixel_size + 3) / 4 * 4;
+    const auto padded_height = height + 2 * padding;
+    const auto padded_stride = ((width + 2 * padding) * pixel_size + 3) / 4 * 4;
+    padded.resize(padded_stride * padded_height);
+
+    for (size_t y = 0; y < padded_height; ++y) {
+        const auto *src = image + std::min(std::max(y, padding) - padding, height - 1) * image_stride;
+        auto *dst = padded.data() + y * padded_stride;
+        for (size_t x = 0; x < padding; ++x) {
+            std::memcpy(dst + x * pixel_size, src, pixel_size);
+            std::memcpy(dst + (padding + width + x) * pixel_size, src + (width - 1) * pixel_size, pixel_size);
+        }
+        std::memcpy(dst + padding * pixel_size, src, width * pixel_size);
+    }
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+texture_atlas_t::texture_atlas_t(gl_t &gl, int unit, size_t page_size, texture_internal_format_t format,
+                                 size_t padding)
+    : m_gl(gl), m_unit(unit), m_page_size(page_size), m_format(format), m_padding(padding) {
+    assert(page_size > 2 * padding);
+}
+
+size_t texture_atlas_t::insert(size_t width, size_t height, texture_format_t format, const void *data,
+                               pixel_type_t type) {
+    assert(width > 0 && height > 0);
+
+    const auto padded_width = width + 2 * m_padding;
+    const auto padded_height = height + 2 * m_padding;
+    if (padded_width > m_page_size || padded_height > m_page_size) {
+        throw std::length_error("texture_atlas_t image too large: " + std::to_string(width) + "x" +
+                                std::to_string(height) + " for pages of " + std::to_string(m_page_size));
+    }
+
+    size_t page = 0;
+    std::optional<rect_t> padded;
+    while (page < m_pages.size() && !(padded = m_pages[page].m_packer.insert(padded_width, padded_height))) {
+        ++page;
+    }
+    if (!padded) {
+        padded = add_page().m_packer.insert(padded_width, padded_height);
+        assert(padded);
+    }
+
+    const rect_t rect{padded->m_x + m_padding, padded->m_y + m_padding, width, height};
+    auto &texture = m_pages[page].m_texture;
+    texture.bind();
+    if (m_padding == 0) {
+        texture.set_sub_image(0, rect.m_x, rect.m_y, width, height, format, data, type);
+    } else {
+        // Filling the padding with the edge texels keeps both filtering and mipmaps from sampling whatever the
+        // previous images left there.
+        const auto pixel_size = get_pixel_size(format, type);
+        assert(pixel_size > 0);
+        extrude(static_cast<const std::byte *>(data), width, height, pixel_size, m_padding, m_padded);
+        texture.set_sub_image(0, padded->m_x, padded->m_y, padded_width, padded_height, format, m_padded.data(), type);
+    }
+
+    const auto size = static_cast<float>(m_page_size);
+    const std::array<float, 4> uv = {static_cast<float>(rect.m_x) / size, static_cast<float>(rect.m_y) / size,
+                                     static_cast<float>(rect.m_x + width) / size,
+                                     static_cast<float>(rect.m_y + height) / size};
+
+    const auto handle = m_next_handle++;
+    m_entries.emplace(handle, atlas_entry_t{page, rect, uv});
+    return handle;
+}
+
+void texture_atlas_t::remove(size_t handle) {
+    const auto it = m_entries.find(handle);
+    assert(it != m_entries.end());
+
+    const auto &rect = it->second.m_rect;
+    m_pages[it->second.m_page].m_packer.remove(
+        {rect.m_x - m_padding, rect.m_y - m_padding, rect.m_width + 2 * m_padding, rect.m_height + 2 * m_padding});
+    m_entries.erase(it);
+}
+
+const atlas_entry_t &texture_atlas_t::get_entry(size_t handle) const {
+    return m_entries.at(handle);
+}
+
+texture_t &texture_atlas_t::get_page(size_t page) {
+    assert(page < m_pages.size());
+    return m_pages[page].m_texture;
+}
+
+size_t texture_atlas_t::get_page_count() const {
+    return m_pages.size();
+}
+
+size_t texture_atlas_t::get_page_size() const {
+    return m_page_size;
+}
+
+size_t texture_atlas_t::get_entry_count() const {
+    return m_entries.size();
+}
+
+texture_atlas_t::page_t &texture_atlas_t::add_page() {
+    m_pages.push_back(
+        page_t{texture_t(m_gl, m_unit, texture_target_t::tex_2d), rect_packer_t(m_page_size, m_page_size)});
+    auto &page = m_pages.back();
+    page.m_texture.bind();
+    page.m_texture.allocate(m_page_size, m_page_size, m_format);
+    return page;
+}
+
+std::ostream &operator<<(std::ostream &os, const texture_atlas_t &a) {
+    return os << "texture_atlas(" << &a << ") page_size=" << a.get_page_size() << ", pages=" << a.get_page_count()
+              << ", entries=" << a.get_entry_count();
+}
+
+} // namespace opengl_cpp
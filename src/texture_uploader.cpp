@@ -0,0 +1,128 @@
+#include "texture_uploader.h"
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace {
+
+// Keeps every slot aligned to the default GL_UNPACK_ALIGNMENT.
+constexpr size_t slot_alignment = 4;
+
+const void *buffer_offset(size_t offset) {
+    return reinterpret_cast<const void *>(offset); // NOLINT(*-reinterpret-cast, performance-no-int-to-ptr)
+}
+
+} // namespace
+
+namespace opengl_cpp {
+
+texture_uploader_t::texture_uploader_t(gl_t &gl, size_t slot_size, size_t slot_count)
+    : m_gl(gl), m_buffer(gl, 0, buffer_target_t::pixel_unpack),
+      m_slot_size((slot_size + slot_alignment - 1) / slot_alignment * slot_alignment),
+      m_states(slot_count, slot_state_t::free), m_fences(slot_count, nullptr) {
+    assert(slot_size > 0);
+    assert(slot_count > 0);
+
+    m_mapped = static_cast<std::byte *>(m_buffer.allocate_persistent(m_slot_size * slot_count));
+    // Leaving the buffer bound would turn the pointers of later client memory uploads into offsets.
+    m_gl.unbind(buffer_target_t::pixel_unpack);
+}
+
+texture_uploader_t::~texture_uploader_t() {
+    for (auto *fence : m_fences) {
+        if (fence != nullptr) {
+            m_gl.destroy(fence);
+        }
+    }
+    // Deleting the buffer releases the persistent mapping, no need to bind it to unmap.
+}
+
+std::optional<staging_region_t> texture_uploader_t::acquire(size_t size) {
+    assert(m_mapped);
+
+    if (size > m_slot_size) {
+        throw std::length_error("texture_uploader_t slot too small: " + std::to_string(size) + " bytes requested, " +
+                                std::to_string(m_slot_size) + " available");
+    }
+
+    const std::lock_guard lock(m_mutex);
+    const auto it = std::find(m_states.begin(), m_states.end(), slot_state_t::free);
+    if (it == m_states.end()) {
+        return std::nullopt;
+    }
+
+    *it = slot_state_t::writing;
+    const auto slot = static_cast<size_t>(it - m_states.begin());
+    return staging_region_t{m_mapped + slot * m_slot_size, slot, size};
+}
+
+void texture_uploader_t::discard(const staging_region_t &region) {
+    const std::lock_guard lock(m_mutex);
+    assert(region.m_slot < m_states.size());
+    assert(m_states[region.m_slot] == slot_state_t::writing);
+    m_states[region.m_slot] = slot_state_t::free;
+}
+
+void texture_uploader_t::upload(texture_t &texture, const staging_region_t &region, int level, size_t x, size_t y,
+                                size_t width, size_t height, texture_format_t format, pixel_type_t type) {
+    assert(region.m_slot < m_states.size());
+
+    texture.bind();
+    m_buffer.bind();
+    texture.set_sub_image(level, x, y, width, height, format, buffer_offset(region.m_slot * m_slot_size), type);
+    // Leaving the buffer bound would turn the pointers of later client memory uploads into offsets.
+    m_gl.unbind(buffer_target_t::pixel_unpack);
+    auto *fence = m_gl.fence_sync();
+
+    const std::lock_guard lock(m_mutex);
+    assert(m_states[region.m_slot] == slot_state_t::writing);
+    m_states[region.m_slot] = slot_state_t::in_flight;
+    m_fences[region.m_slot] = fence;
+}
+
+void texture_uploader_t::retire() {
+    const std::lock_guard lock(m_mutex);
+    for (size_t slot = 0; slot < m_states.size(); ++slot) {
+        if (m_states[slot] != slot_state_t::in_flight) {
+            continue;
+        }
+
+        const auto status = m_gl.client_wait_sync(m_fences[slot], 0);
+        if (status == sync_status_t::timeout_expired) {
+            continue;
+        }
+
+        m_gl.destroy(m_fences[slot]);
+        m_fences[slot] = nullptr;
+        m_states[slot] = slot_state_t::free;
+
+        if (status == sync_status_t::wait_failed) {
+            throw std::runtime_error("texture_uploader_t failed waiting for the GPU");
+        }
+    }
+}
+
+const buffer_t &texture_uploader_t::get_buffer() const {
+    return m_buffer;
+}
+
+size_t texture_uploader_t::get_slot_size() const {
+    return m_slot_size;
+}
+
+size_t texture_uploader_t::get_slot_count() const {
+    return m_states.size();
+}
+
+size_t texture_uploader_t::get_free_count() const {
+    const std::lock_guard lock(m_mutex);
+    return static_cast<size_t>(std::count(m_states.begin(), m_states.end(), slot_state_t::free));
+}
+
+std::ostream &operator<<(std::ostream &os, const texture_uploader_t &u) {
+    return os << "texture_uploader(" << &u << ") buffer=" << u.get_buffer().get_id()
+              << ", slot_size=" << u.get_slot_size() << ", slot_count=" << u.get_slot_count();
+}
+
+} // namespace opengl_cpp
@@ -1,6 +1,17 @@
 #include "vertex_array.h"
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+size_t get_index_size(opengl_cpp::index_type_t type) {
+    return type == opengl_cpp::index_type_t::unsigned_short ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+} // namespace
 
 namespace opengl_cpp {
 
@@ -29,13 +40,18 @@ vertex_array_t::vertex_array_t(gl_t &gl, id_vertex_array_t id)
 }
 
 vertex_array_t::vertex_array_t(vertex_array_t &&other) noexcept
-    : m_gl(other.m_gl), m_buffers(std::move(other.m_buffers)) {
+    : m_gl(other.m_gl), m_buffers(std::move(other.m_buffers)), m_vertex_count(other.m_vertex_count),
+      m_index_count(other.m_index_count), m_index_type(other.m_index_type), m_instance_count(other.m_instance_count) {
 
     if (m_id) {
         destroy();
     }
 
     m_id = std::move(other.m_id);
+    other.m_vertex_count = 0;
+    other.m_index_count = 0;
+    other.m_index_type = index_type_t::undefined;
+    other.m_instance_count = 0;
 }
 
 vertex_array_t::~vertex_array_t() {
@@ -51,6 +67,14 @@ vertex_array_t &vertex_array_t::operator=(vertex_array_t &&other) noexcept {
 
     m_id = std::move(other.m_id);
     m_buffers = std::move(other.m_buffers);
+    m_vertex_count = other.m_vertex_count;
+    m_index_count = other.m_index_count;
+    m_index_type = other.m_index_type;
+    m_instance_count = other.m_instance_count;
+    other.m_vertex_count = 0;
+    other.m_index_count = 0;
+    other.m_index_type = index_type_t::undefined;
+    other.m_instance_count = 0;
     return *this;
 }
 
@@ -64,22 +88,127 @@ const id_vertex_array_t &vertex_array_t::get_id() const {
 }
 
 void vertex_array_t::load(const std::vector<vertex_t> &vertices) {
-    bind();
+    load(vertices, vertex_layout);
+}
+
+void vertex_array_t::load(const std::vector<vertex_t> &vertices, const std::vector<unsigned> &indices) {
+    load(vertices, indices, vertex_layout);
+}
 
+void vertex_array_t::load(const void *vertices, size_t vertex_count, const vertex_attribute_t *attributes,
+                          size_t attribute_count, size_t stride) {
+    bind();
     m_buffers[0].bind();
-    m_buffers[0].load(vertices);
+    m_buffers[0].load(vertices, vertex_count * stride);
+    m_vertex_count = vertex_count;
+    m_index_count = 0;
+    m_index_type = index_type_t::undefined;
+    set_layout(attributes, attribute_count, stride);
+}
+
+void vertex_array_t::set_layout(const vertex_attribute_t *attributes, size_t count, size_t stride) {
+    for (size_t i = 0; i < count; ++i) {
+        const auto &attribute = attributes[i];
+        assert(attribute.m_offset < stride);
+        m_gl.vertex_attrib_pointer(attribute.m_location, attribute.m_components, attribute.m_type,
+                                   attribute.m_normalized, stride, attribute.m_offset);
+        m_gl.enable_vertex_attrib_array(attribute.m_location);
+    }
+}
+
+void vertex_array_t::load_indices(const std::vector<unsigned> &indices) {
+    if (m_vertex_count <= size_t{std::numeric_limits<uint16_t>::max()} + 1) {
+        std::vector<uint16_t> narrow;
+        narrow.reserve(indices.size());
+        for (const auto index : indices) {
+            assert(index < m_vertex_count);
+            narrow.push_back(static_cast<uint16_t>(index));
+        }
+        load_indices(narrow.data(), narrow.size(), index_type_t::unsigned_short);
+    } else {
+        load_indices(indices.data(), indices.size(), index_type_t::unsigned_int);
+    }
+}
+
+void vertex_array_t::load_indices(const void *indices, size_t index_count, index_type_t type) {
+    assert(type != index_type_t::undefined);
+
+    // The element array binding is part of the vertex array state, so the vertex array must be bound first.
+    bind();
+    m_buffers[1].bind();
+    m_buffers[1].load(indices, index_count * get_index_size(type));
+    m_index_type = type;
+    m_index_count = index_count;
+}
+
+void vertex_array_t::draw() const {
+    draw(0, m_index_type == index_type_t::undefined ? m_vertex_count : m_index_count);
+}
+
+void vertex_array_t::draw(size_t first, size_t count) const {
+    bind();
+    if (m_index_type == index_type_t::undefined) {
+        assert(first + count <= m_vertex_count);
+        if (m_instance_count > 0) {
+            m_gl.draw_arrays_instanced(static_cast<int>(first), count, m_instance_count);
+        } else {
+            m_gl.draw_arrays(static_cast<int>(first), count);
+        }
+        return;
+    }
 
-    //    m_buffers[1].bind(); Disable as we don't support element drawing for now.
-    //    m_buffers[1].load(indices);
+    assert(first + count <= m_index_count);
+    const auto offset = first * get_index_size(m_index_type);
+    if (m_instance_count > 0) {
+        m_gl.draw_elements_instanced(count, m_index_type, offset, m_instance_count);
+    } else {
+        m_gl.draw_elements(count, m_index_type, offset);
+    }
+}
 
-    m_gl.vertex_attrib_pointer(0, 3, sizeof(vertex_t), 0);
-    m_gl.enable_vertex_attrib_array(0);
+size_t vertex_array_t::get_vertex_count() const {
+    return m_vertex_count;
+}
 
-    m_gl.vertex_attrib_pointer(1, 2, sizeof(vertex_t), sizeof(vertex_t::m_pos));
-    m_gl.enable_vertex_attrib_array(1);
+size_t vertex_array_t::get_index_count() const {
+    return m_index_count;
+}
 
-    m_gl.vertex_attrib_pointer(2, 3, sizeof(vertex_t), sizeof(vertex_t::m_pos) + sizeof(vertex_t::m_tex));
-    m_gl.enable_vertex_attrib_array(2);
+index_type_t vertex_array_t::get_index_type() const {
+    return m_index_type;
+}
+
+size_t vertex_array_t::get_instance_count() const {
+    return m_instance_count;
+}
+
+void vertex_array_t::load_instances(unsigned first_location, const void *data, size_t count, size_t stride,
+                                    const std::vector<size_t> &components, unsigned divisor) {
+    assert(divisor > 0);
+    bind();
+
+    constexpr size_t instance_buffer = 2;
+    if (m_buffers.size() <= instance_buffer) {
+        m_buffers.emplace_back(m_gl, 0, buffer_target_t::simple_array);
+    }
+
+    // Respecifying the whole storage orphans the previous one, so the driver does not have to wait for draws still
+    // reading it.
+    auto &buffer = m_buffers[instance_buffer];
+    buffer.bind();
+    buffer.load(data, count * stride, buffer_usage_t::dynamic_draw);
+    m_instance_count = count * divisor;
+
+    unsigned offset = 0;
+    for (size_t i = 0; i < components.size(); ++i) {
+        assert(components[i] >= 1 && components[i] <= 4);
+        const auto location = first_location + static_cast<unsigned>(i);
+        m_gl.vertex_attrib_pointer(location, components[i], stride, offset);
+        m_gl.enable_vertex_attrib_array(location);
+        m_gl.vertex_attrib_divisor(location, divisor);
+        offset += components[i] * sizeof(float);
+    }
+    assert(offset <= stride);
 }
 
 void vertex_array_t::destroy() {
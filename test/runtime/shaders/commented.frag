@@ -0,0 +1,7 @@
+#version 330 core
+// #include "missing.glsl"
+/* A block comment
+#include "missing.glsl"
+*/
+#include "common.glsl" /*
+#include <missing.glsl> */
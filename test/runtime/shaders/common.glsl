@@ -0,0 +1,2 @@
+#include <lighting.glsl>
+out vec4 color;
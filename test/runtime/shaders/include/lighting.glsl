@@ -0,0 +1,4 @@
+#include "../common.glsl"
+vec4 shade(vec4 c) {
+    return c;
+}
\ No newline at end of file
@@ -0,0 +1,7 @@
+#version 330 core
+#include "common.glsl"
+#include <lighting.glsl>
+
+void main() {
+    color = shade(vec4(1.0));
+}
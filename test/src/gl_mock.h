@@ -1,7 +1,9 @@
 #pragma once
 
+#include <cstddef>
 #include <gmock/gmock.h>
 #include <opengl-cpp/backend/gl.h>
+#include <vector>
 
 namespace opengl_cpp::test {
 
@@ -12,7 +14,12 @@ class gl_mock_t : public opengl_cpp::gl_t {
     MOCK_METHOD(void, bind, (const buffer_t &b), (override));
     MOCK_METHOD(void, bind, (const texture_t &t), (override));
     MOCK_METHOD(void, bind, (const vertex_array_t &va), (override));
-    MOCK_METHOD(void, buffer_data, (const buffer_t &b, size_t size, const void *data), (override));
+    MOCK_METHOD(void, buffer_data, (const buffer_t &b, size_t size, const void *data, buffer_usage_t usage),
+                (override));
+    MOCK_METHOD(void, buffer_sub_data, (const buffer_t &b, size_t offset, size_t size, const void *data),
+                (override));
+    MOCK_METHOD(void, buffer_storage, (const buffer_t &b, size_t size, const void *data, buffer_access_t flags),
+                (override));
     MOCK_METHOD(void, clear, (), (override));
     MOCK_METHOD(void, set_clear_color, (const glm::vec4 &c), (override));
     MOCK_METHOD(error_t, compile, (const shader_t &s), (override));
@@ -21,37 +28,112 @@ class gl_mock_t : public opengl_cpp::gl_t {
     MOCK_METHOD(std::vector<id_buffer_t>, new_buffers, (size_t n), (override));
     MOCK_METHOD(std::vector<id_texture_t>, new_textures, (size_t n), (override));
     MOCK_METHOD(std::vector<id_vertex_array_t>, new_vertex_arrays, (size_t n), (override));
+    MOCK_METHOD(std::vector<id_query_t>, new_queries, (size_t n), (override));
     MOCK_METHOD(void, destroy, (size_t n, const id_buffer_t *buffers), (override));
     MOCK_METHOD(void, destroy, (const id_program_t &program), (override));
     MOCK_METHOD(void, destroy, (const id_shader_t &shader), (override));
     MOCK_METHOD(void, destroy, (size_t n, const id_texture_t *textures), (override));
     MOCK_METHOD(void, destroy, (size_t n, const id_vertex_array_t *arrays), (override));
+    MOCK_METHOD(void, destroy, (size_t n, const id_query_t *queries), (override));
+    MOCK_METHOD(void, destroy, (sync_t sync), (override));
     MOCK_METHOD(void, disable, (graphics_feature_t cap), (override));
     MOCK_METHOD(void, draw_arrays, (int first, size_t count), (override));
-    MOCK_METHOD(void, draw_elements, (const std::vector<unsigned> &indices), (override));
+    MOCK_METHOD(void, draw_arrays_instanced, (int first, size_t count, size_t instances), (override));
+    MOCK_METHOD(void, draw_elements, (size_t count, index_type_t type, size_t offset), (override));
+    MOCK_METHOD(void, draw_elements_instanced, (size_t count, index_type_t type, size_t offset, size_t instances),
+                (override));
+    MOCK_METHOD(void, multi_draw_arrays_indirect, (size_t offset, size_t draw_count, size_t stride), (override));
+    MOCK_METHOD(void, multi_draw_elements_indirect,
+                (index_type_t type, size_t offset, size_t draw_count, size_t stride), (override));
     MOCK_METHOD(void, enable, (graphics_feature_t cap), (override));
     MOCK_METHOD(void, enable_vertex_attrib_array, (unsigned index), (override));
+    MOCK_METHOD(sync_t, fence_sync, (), (override));
+    MOCK_METHOD(sync_status_t, client_wait_sync, (sync_t sync, uint64_t timeout), (override));
     MOCK_METHOD(void, generate_mipmap, (const texture_t &t), (override));
+    MOCK_METHOD(std::string, get_active_uniform, (const program_t &p, unsigned index), (override));
     MOCK_METHOD(std::string, get_info_log, (const program_t &p), (override));
     MOCK_METHOD(std::string, get_info_log, (const shader_t &s), (override));
+    MOCK_METHOD(uint64_t, get_query_result, (const id_query_t &q), (override));
+    MOCK_METHOD(int64_t, get_timestamp, (), (override));
     MOCK_METHOD(int, get_parameter, (const program_t &p, program_parameter_t param), (override));
     MOCK_METHOD(int, get_parameter, (const shader_t &s, shader_parameter_t param), (override));
+    MOCK_METHOD(program_binary_t, get_program_binary, (const program_t &p), (override));
+    MOCK_METHOD(std::string, get_string, (string_name_t name), (override));
     MOCK_METHOD(int, get_uniform_location, (const program_t &p, const char *name), (override));
+    MOCK_METHOD(bool, has_extension, (extension_t ext), (override));
+    MOCK_METHOD(bool, is_query_result_available, (const id_query_t &q), (override));
     MOCK_METHOD(error_t, link, (const program_t &p), (override));
+    MOCK_METHOD(error_t, program_binary, (const program_t &p, const program_binary_t &binary), (override));
+    MOCK_METHOD(void *, map_buffer_range, (const buffer_t &b, size_t offset, size_t length, buffer_access_t access),
+                (override));
+    MOCK_METHOD(void, max_shader_compiler_threads, (unsigned count), (override));
     MOCK_METHOD(void, polygon_mode, (polygon_mode_t mode), (override));
-    MOCK_METHOD(void, set_sources, (const shader_t &s, size_t num_sources, const char **sources), (override));
-    MOCK_METHOD(void, set_image, (size_t width, size_t height, texture_format_t format, const unsigned char *data),
+    MOCK_METHOD(void, query_counter, (const id_query_t &q), (override));
+    MOCK_METHOD(void, set_sources, (const shader_t &s, size_t num_sources, const char **sources, const int *lengths),
+                (override));
+    MOCK_METHOD(void, set_image,
+                (const texture_t &t, size_t width, size_t height, texture_format_t format, const unsigned char *data),
+                (override));
+    MOCK_METHOD(void, set_parameter, (const texture_t &t, texture_parameter_t name, texture_parameter_values_t value),
+                (override));
+    MOCK_METHOD(void, set_sub_image,
+                (const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                 texture_format_t format, pixel_type_t type, const void *data),
+                (override));
+    MOCK_METHOD(void, set_sub_image_3d,
+                (const texture_t &t, int level, size_t x, size_t y, size_t z, size_t width, size_t height, size_t depth,
+                 texture_format_t format, pixel_type_t type, const void *data),
                 (override));
-    MOCK_METHOD(void, set_parameter, (texture_parameter_t name, texture_parameter_values_t value), (override));
+    MOCK_METHOD(void, texture_storage,
+                (const texture_t &t, size_t levels, texture_internal_format_t format, size_t width, size_t height),
+                (override));
+    MOCK_METHOD(void, texture_storage_3d,
+                (const texture_t &t, size_t levels, texture_internal_format_t format, size_t width, size_t height,
+                 size_t depth),
+                (override));
+    MOCK_METHOD(void, compressed_image,
+                (const texture_t &t, int level, texture_internal_format_t format, size_t width, size_t height,
+                 size_t size, const void *data),
+                (override));
+    MOCK_METHOD(void, compressed_sub_image,
+                (const texture_t &t, int level, size_t x, size_t y, size_t width, size_t height,
+                 texture_internal_format_t format, size_t size, const void *data),
+                (override));
+    MOCK_METHOD(void, set_parameter, (const program_t &p, program_parameter_t param, int value), (override));
     MOCK_METHOD(void, set_uniform, (int location, float v0), (override));
     MOCK_METHOD(void, set_uniform, (int location, int v0), (override));
     MOCK_METHOD(void, set_uniform, (int location, const glm::vec3 &v), (override));
     MOCK_METHOD(void, set_uniform, (int location, (const std::array<float, 3> &v)), (override));
     MOCK_METHOD(void, set_uniform, (int location, (const std::array<float, 4> &v)), (override));
     MOCK_METHOD(void, set_uniform, (int location, const glm::mat4 &value), (override));
+    MOCK_METHOD(bool, unmap_buffer, (const buffer_t &b), (override));
+    MOCK_METHOD(void, unbind, (buffer_target_t target), (override));
     MOCK_METHOD(void, use, (const program_t &p), (override));
     MOCK_METHOD(void, vertex_attrib_pointer, (unsigned index, size_t size, size_t stride, unsigned offset), (override));
+    MOCK_METHOD(void, vertex_attrib_pointer,
+                (unsigned index, size_t size, vertex_attrib_type_t type, bool normalized, size_t stride,
+                 unsigned offset),
+                (override));
+    MOCK_METHOD(void, vertex_attrib_divisor, (unsigned index, unsigned divisor), (override));
     MOCK_METHOD(void, set_viewport, (size_t width, size_t height), (override));
 };
 
+inline sync_t make_sync(uintptr_t value) {
+    return reinterpret_cast<sync_t>(value); // NOLINT(*-reinterpret-cast, performance-no-int-to-ptr)
+}
+
+/**
+ * @brief Expects buffer_t::allocate_persistent() to create and map storage for one buffer, the mapping pointing into
+ * storage. The buffer binds are left to the caller, which knows how many of them come after.
+ */
+inline void expect_persistent_mapping(gl_mock_t &gl, std::vector<std::byte> &storage) {
+    using ::testing::_;
+    using ::testing::Exactly;
+    using ::testing::Return;
+
+    EXPECT_CALL(gl, has_extension(extension_t::buffer_storage)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, buffer_storage(_, storage.size(), nullptr, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, map_buffer_range(_, 0, storage.size(), _)).Times(Exactly(1)).WillOnce(Return(storage.data()));
+}
+
 } // namespace opengl_cpp::test
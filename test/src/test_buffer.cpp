@@ -79,3 +79,100 @@ TEST(BufferTest, bind) {
     auto buffer = buffer_t(gl, 1, buffer_target_t::element_array);
     buffer.bind();
 }
+
+TEST(BufferTest, loadWithUsage) {
+    gl_mock_t gl;
+    const std::vector<float> data = {1.0F, 2.0F, 3.0F};
+
+    EXPECT_CALL(gl, buffer_data(A<const buffer_t &>(), data.size() * sizeof(float),
+                                static_cast<const void *>(data.data()), buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    buffer.load(data, buffer_usage_t::dynamic_draw);
+    EXPECT_EQ(buffer.get_size(), data.size() * sizeof(float));
+}
+
+TEST(BufferTest, allocateThenUpdate) {
+    gl_mock_t gl;
+    const std::vector<float> data = {1.0F, 2.0F};
+    constexpr size_t size = 64;
+    constexpr size_t offset = 16;
+
+    EXPECT_CALL(gl, buffer_data(A<const buffer_t &>(), size, nullptr, buffer_usage_t::stream_draw)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_sub_data(A<const buffer_t &>(), offset, data.size() * sizeof(float),
+                                    static_cast<const void *>(data.data())))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    buffer.allocate(size, buffer_usage_t::stream_draw);
+    buffer.update(offset, data);
+    EXPECT_EQ(buffer.get_size(), size);
+}
+
+TEST(BufferTest, allocatePersistent) {
+    gl_mock_t gl;
+    std::vector<std::byte> storage(128);
+
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(1));
+    expect_persistent_mapping(gl, storage);
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    EXPECT_EQ(buffer.allocate_persistent(storage.size()), storage.data());
+    EXPECT_EQ(buffer.get_size(), storage.size());
+}
+
+TEST(BufferTest, allocatePersistentStorageFlags) {
+    gl_mock_t gl;
+    std::vector<std::byte> storage(128);
+    const auto map_flags = buffer_access_t::map_write | buffer_access_t::map_persistent;
+    const auto storage_flags = map_flags | buffer_access_t::dynamic_storage | buffer_access_t::client_storage;
+
+    EXPECT_CALL(gl, has_extension(extension_t::buffer_storage)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_storage(A<const buffer_t &>(), storage.size(), nullptr, storage_flags)).Times(Exactly(1));
+    EXPECT_CALL(gl, map_buffer_range(A<const buffer_t &>(), 0, storage.size(), map_flags))
+        .Times(Exactly(1))
+        .WillOnce(Return(storage.data()));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    EXPECT_EQ(buffer.allocate_persistent(storage.size(), storage_flags), storage.data());
+}
+
+TEST(BufferTest, allocatePersistentMissingExtension) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, has_extension(extension_t::buffer_storage)).Times(Exactly(1)).WillOnce(Return(false));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    EXPECT_THROW(buffer.allocate_persistent(128), std::runtime_error);
+    EXPECT_EQ(buffer.get_size(), 0);
+}
+
+TEST(BufferTest, allocatePersistentMapFailure) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, has_extension(extension_t::buffer_storage)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_storage(A<const buffer_t &>(), 128, nullptr, A<buffer_access_t>())).Times(Exactly(1));
+    EXPECT_CALL(gl, map_buffer_range(A<const buffer_t &>(), 0, 128, A<buffer_access_t>()))
+        .Times(Exactly(1))
+        .WillOnce(Return(nullptr));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    EXPECT_THROW(buffer.allocate_persistent(128), std::runtime_error);
+}
+
+TEST(BufferTest, updateOutOfRange) {
+    gl_mock_t gl;
+    const std::vector<float> data = {1.0F, 2.0F};
+
+    auto buffer = buffer_t(gl, 1, buffer_target_t::simple_array);
+    EXPECT_DEATH(buffer.update(0, data), "offset \\+ count \\* sizeof\\(type_t\\) <= m_size");
+}
@@ -0,0 +1,149 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/draw_batch.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::AnyNumber;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+void expect_vertex_array(gl_mock_t &gl) {
+    EXPECT_CALL(gl, new_buffers(2)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1, 2}));
+    EXPECT_CALL(gl, bind(A<const vertex_array_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, buffer_data(_, _, _, buffer_usage_t::static_draw)).Times(AnyNumber());
+    EXPECT_CALL(gl, vertex_attrib_pointer(_, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(gl, enable_vertex_attrib_array(_)).Times(AnyNumber());
+    EXPECT_CALL(gl, destroy(1, A<const id_vertex_array_t *>())).Times(Exactly(1));
+}
+
+} // namespace
+
+TEST(DrawBatchTest, missingExtension) {
+    gl_mock_t gl;
+    expect_vertex_array(gl);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, has_extension(extension_t::multi_draw_indirect)).Times(Exactly(1)).WillOnce(Return(false));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(3));
+
+    vertex_array_t va(gl, 1);
+    std::unique_ptr<draw_batch_t> b;
+    EXPECT_THROW(b = std::make_unique<draw_batch_t>(gl, va), std::runtime_error);
+}
+
+TEST(DrawBatchTest, submitIndexed) {
+    gl_mock_t gl;
+    expect_vertex_array(gl);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, has_extension(extension_t::multi_draw_indirect)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(3));
+
+    std::vector<draw_elements_indirect_command_t> uploaded;
+    EXPECT_CALL(gl, buffer_data(_, 2 * sizeof(draw_elements_indirect_command_t), _, buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1))
+        .WillOnce([&uploaded](const buffer_t &b, size_t size, const void *data, buffer_usage_t) {
+            EXPECT_EQ(b.get_target(), buffer_target_t::draw_indirect);
+            const auto *commands = static_cast<const draw_elements_indirect_command_t *>(data);
+            uploaded.assign(commands, commands + size / sizeof(draw_elements_indirect_command_t));
+        });
+    EXPECT_CALL(gl, has_extension(extension_t::base_instance)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, multi_draw_elements_indirect(index_type_t::unsigned_short, 0, 2, 0)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(std::vector<vertex_t>(6), {0, 1, 2, 0, 1, 2});
+
+    draw_batch_t b(gl, va);
+    b.add(0, 3);
+    b.add(3, 3, 3, 10, 1);
+    EXPECT_TRUE(b.is_indexed());
+    b.submit();
+
+    ASSERT_EQ(uploaded.size(), 2);
+    EXPECT_EQ(uploaded[1].m_count, 3);
+    EXPECT_EQ(uploaded[1].m_instance_count, 10);
+    EXPECT_EQ(uploaded[1].m_first_index, 3);
+    EXPECT_EQ(uploaded[1].m_base_vertex, 3);
+    EXPECT_EQ(uploaded[1].m_base_instance, 1);
+
+    b.clear();
+    EXPECT_EQ(b.size(), 0);
+    b.submit();
+}
+
+TEST(DrawBatchTest, submitArrays) {
+    gl_mock_t gl;
+    expect_vertex_array(gl);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, has_extension(extension_t::multi_draw_indirect)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(3));
+    EXPECT_CALL(gl, buffer_data(_, 3 * sizeof(draw_arrays_indirect_command_t), _, buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, multi_draw_arrays_indirect(0, 3, 0)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(std::vector<vertex_t>(9));
+
+    draw_batch_t b(gl, va);
+    b.add(0, 3);
+    b.add(3, 3);
+    b.add(6, 3);
+    EXPECT_FALSE(b.is_indexed());
+    b.submit();
+}
+
+TEST(DrawBatchTest, baseInstanceMissingExtension) {
+    gl_mock_t gl;
+    expect_vertex_array(gl);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, has_extension(extension_t::multi_draw_indirect)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, has_extension(extension_t::base_instance)).Times(Exactly(1)).WillOnce(Return(false));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(3));
+
+    vertex_array_t va(gl, 1);
+    va.load(std::vector<vertex_t>(3));
+
+    draw_batch_t b(gl, va);
+    b.add(0, 3, 0, 2);
+    EXPECT_THROW(b.add(0, 3, 0, 2, 1), std::runtime_error);
+    EXPECT_EQ(b.size(), 1);
+}
+
+TEST(DrawBatchTest, submitUploadsOnlyChanges) {
+    gl_mock_t gl;
+    expect_vertex_array(gl);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, has_extension(extension_t::multi_draw_indirect)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(3));
+    EXPECT_CALL(gl, buffer_data(_, sizeof(draw_arrays_indirect_command_t), _, buffer_usage_t::dynamic_draw))
+        .Times(Exactly(2));
+    EXPECT_CALL(gl, buffer_data(_, 2 * sizeof(draw_arrays_indirect_command_t), _, buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, multi_draw_arrays_indirect(0, 1, 0)).Times(Exactly(4));
+    EXPECT_CALL(gl, multi_draw_arrays_indirect(0, 2, 0)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(std::vector<vertex_t>(6));
+
+    draw_batch_t b(gl, va);
+    b.add(0, 3);
+    b.submit();
+    b.submit();
+    b.add(3, 3);
+    b.submit();
+    b.clear();
+    b.add(0, 3);
+    b.submit();
+    b.submit();
+}
@@ -0,0 +1,123 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/backend/gl_command_list.h"
+#include "opengl-cpp/buffer.h"
+#include "opengl-cpp/texture.h"
+#include "gtest/gtest.h"
+#include <cstring>
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::Exactly;
+using ::testing::InSequence;
+using ::testing::Invoke;
+using ::testing::Matcher;
+using ::testing::Ref;
+using ::testing::TypedEq;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+TEST(GlCommandListTest, replayInOrder) {
+    gl_mock_t gl;
+    gl_command_list_t commands;
+
+    buffer_t buffer(gl, 1, buffer_target_t::simple_array);
+    texture_t texture(gl, 2, texture_target_t::tex_2d, 3);
+    const glm::mat4 model(1.0F);
+
+    commands.bind(buffer);
+    commands.activate(texture);
+    commands.bind(texture);
+    commands.set_uniform(4, model);
+    commands.set_uniform(5, 1.5F);
+    commands.draw_arrays(0, 36);
+
+    EXPECT_FALSE(commands.empty());
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(gl, bind(Matcher<const buffer_t &>(Ref(buffer)))).Times(Exactly(1));
+        EXPECT_CALL(gl, activate(Ref(texture))).Times(Exactly(1));
+        EXPECT_CALL(gl, bind(Matcher<const texture_t &>(Ref(texture)))).Times(Exactly(1));
+        EXPECT_CALL(gl, set_uniform(4, Matcher<const glm::mat4 &>(model))).Times(Exactly(1));
+        EXPECT_CALL(gl, set_uniform(5, TypedEq<float>(1.5F))).Times(Exactly(1));
+        EXPECT_CALL(gl, draw_arrays(0, 36)).Times(Exactly(1));
+        EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+        EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+    }
+
+    commands.replay(gl);
+}
+
+TEST(GlCommandListTest, payloadsAreCopied) {
+    gl_mock_t gl;
+    gl_command_list_t commands;
+
+    buffer_t buffer(gl, 1, buffer_target_t::simple_array);
+    const std::vector<float> expected = {1.0F, 2.0F, 3.0F};
+
+    {
+        auto data = expected;
+        commands.buffer_data(buffer, data.size() * sizeof(float), data.data(), buffer_usage_t::dynamic_draw);
+        data.assign(data.size(), 0.0F);
+    }
+
+    EXPECT_CALL(gl, buffer_data(Ref(buffer), expected.size() * sizeof(float), _, buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1))
+        .WillOnce(Invoke([&](const buffer_t &, size_t size, const void *data, buffer_usage_t) {
+            EXPECT_EQ(std::memcmp(data, expected.data(), size), 0);
+        }));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+
+    commands.replay(gl);
+}
+
+TEST(GlCommandListTest, unpackBufferOffsetsAreKept) {
+    gl_mock_t gl;
+    gl_command_list_t commands;
+
+    buffer_t buffer(gl, 1, buffer_target_t::pixel_unpack);
+    texture_t texture(gl, 0, texture_target_t::tex_2d_array, 2);
+    const auto *offset = reinterpret_cast<const void *>(256); // NOLINT(*-reinterpret-cast, *-no-int-to-ptr)
+
+    commands.bind(buffer);
+    commands.set_sub_image_3d(texture, 0, 0, 0, 3, 2, 2, 1, texture_format_t::rgba, pixel_type_t::unsigned_byte,
+                              offset);
+    commands.unbind(buffer_target_t::pixel_unpack);
+
+    {
+        InSequence sequence;
+        EXPECT_CALL(gl, bind(Matcher<const buffer_t &>(Ref(buffer)))).Times(Exactly(1));
+        EXPECT_CALL(gl, set_sub_image_3d(Ref(texture), 0, 0, 0, 3, 2, 2, 1, texture_format_t::rgba,
+                                         pixel_type_t::unsigned_byte, offset))
+            .Times(Exactly(1));
+        EXPECT_CALL(gl, unbind(buffer_target_t::pixel_unpack)).Times(Exactly(1));
+        EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+        EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+    }
+
+    commands.replay(gl);
+}
+
+TEST(GlCommandListTest, resetDropsCommands) {
+    gl_mock_t gl;
+    gl_command_list_t commands;
+
+    commands.clear();
+    commands.draw_arrays(0, 3);
+    commands.reset();
+    EXPECT_TRUE(commands.empty());
+
+    EXPECT_CALL(gl, clear()).Times(Exactly(0));
+    EXPECT_CALL(gl, draw_arrays(A<int>(), A<size_t>())).Times(Exactly(0));
+
+    commands.replay(gl);
+}
+
+TEST(GlCommandListTest, queriesThrow) {
+    gl_command_list_t commands;
+
+    EXPECT_THROW(commands.new_buffers(1), std::logic_error);
+    EXPECT_THROW(commands.new_program(), std::logic_error);
+}
@@ -0,0 +1,140 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/backend/gl_counters.h"
+#include "opengl-cpp/buffer.h"
+#include "opengl-cpp/program.h"
+#include "opengl-cpp/texture.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::AnyNumber;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+TEST(GlCountersTest, countsFrame) {
+    gl_mock_t gl;
+    gl_counters_t counters(gl);
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(5)));
+    EXPECT_CALL(gl, new_buffers(2)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1, 2}));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(2));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(2));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, use(_)).Times(Exactly(2));
+    EXPECT_CALL(gl, set_uniform(_, A<float>())).Times(Exactly(1));
+    EXPECT_CALL(gl, set_uniform(_, A<const glm::mat4 &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, 256, _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, 1024, nullptr, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_sub_data(_, 0, 64, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_image(_, 4, 2, texture_format_t::rgb, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 0, 0, 2, 2, texture_format_t::rgba, pixel_type_t::half_float, _))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, draw_elements(36, index_type_t::unsigned_short, 0)).Times(Exactly(1));
+    EXPECT_CALL(gl, draw_arrays_instanced(0, 3, 10)).Times(Exactly(1));
+    EXPECT_CALL(gl, multi_draw_elements_indirect(index_type_t::unsigned_int, 0, 7, 0)).Times(Exactly(1));
+
+    const std::vector<unsigned char> pixels(32);
+    {
+        auto buffers = buffer_t::build(counters, 2);
+        buffers[0].set_target(buffer_target_t::simple_array);
+        const program_t program(counters);
+        texture_t texture(counters, 0, texture_target_t::tex_2d, 3);
+
+        counters.bind(buffers[0]);
+        counters.bind(buffers[0]);
+        counters.bind(texture);
+        counters.use(program);
+        counters.use(program);
+        counters.set_uniform(1, 1.0F);
+        counters.set_uniform(2, glm::mat4(1.0F));
+        counters.buffer_data(buffers[0], 256, pixels.data(), buffer_usage_t::static_draw);
+        counters.buffer_data(buffers[1], 1024, nullptr, buffer_usage_t::dynamic_draw);
+        counters.buffer_sub_data(buffers[1], 0, 64, pixels.data());
+        counters.set_image(texture, 4, 2, texture_format_t::rgb, pixels.data());
+        counters.set_sub_image(texture, 0, 0, 0, 2, 2, texture_format_t::rgba, pixel_type_t::half_float, nullptr);
+        counters.draw_elements(36, index_type_t::unsigned_short, 0);
+        counters.draw_arrays_instanced(0, 3, 10);
+        counters.multi_draw_elements_indirect(index_type_t::unsigned_int, 0, 7, 0);
+    }
+
+    const auto &frame = counters.get_current();
+    EXPECT_EQ(frame.m_frame, 0);
+    EXPECT_EQ(frame.m_draw_calls, 9);
+    EXPECT_EQ(frame.m_vertices, 66);
+    EXPECT_EQ(frame.m_buffer_binds, 2);
+    EXPECT_EQ(frame.m_texture_binds, 1);
+    EXPECT_EQ(frame.m_vertex_array_binds, 0);
+    EXPECT_EQ(frame.m_program_switches, 1);
+    EXPECT_EQ(frame.m_uniform_updates, 2);
+    EXPECT_EQ(frame.m_buffer_bytes, 320);
+    EXPECT_EQ(frame.m_texture_bytes, 24 + 32);
+    EXPECT_EQ(frame.m_objects_created, 3);
+    EXPECT_EQ(frame.m_objects_destroyed, 4);
+}
+
+TEST(GlCountersTest, programSwitches) {
+    gl_mock_t gl;
+    gl_counters_t counters(gl);
+
+    EXPECT_CALL(gl, new_program())
+        .Times(Exactly(3))
+        .WillOnce(Return(id_program_t(5)))
+        .WillOnce(Return(id_program_t(6)))
+        .WillOnce(Return(id_program_t(5)));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(3));
+    EXPECT_CALL(gl, use(_)).Times(Exactly(6));
+
+    {
+        const program_t first(counters);
+        const program_t second(counters);
+        counters.use(first);
+        counters.use(first);
+        counters.use(second);
+        counters.use(first);
+    }
+    EXPECT_EQ(counters.get_current().m_program_switches, 3);
+
+    // Program names are reused once deleted, so using the new program with the last name is still a switch.
+    counters.end_frame();
+    const program_t third(counters);
+    counters.use(third);
+    counters.use(third);
+    EXPECT_EQ(counters.get_current().m_program_switches, 1);
+}
+
+TEST(GlCountersTest, historyAndCsv) {
+    gl_mock_t gl;
+    gl_counters_t counters(gl, 2);
+    EXPECT_CALL(gl, draw_arrays(0, _)).Times(AnyNumber());
+
+    for (size_t frame = 0; frame < 3; ++frame) {
+        for (size_t i = 0; i <= frame; ++i) {
+            counters.draw_arrays(0, 3);
+        }
+        counters.end_frame();
+    }
+    EXPECT_EQ(counters.get_current().m_frame, 3);
+    EXPECT_EQ(counters.get_current().m_draw_calls, 0);
+
+    // Only the last two frames are kept.
+    const auto history = counters.get_history();
+    ASSERT_EQ(history.size(), 2);
+    EXPECT_EQ(history[0].m_frame, 1);
+    EXPECT_EQ(history[0].m_draw_calls, 2);
+    EXPECT_EQ(history[1].m_vertices, 9);
+
+    std::ostringstream csv;
+    counters.write_csv(csv);
+    EXPECT_EQ(csv.str(), "frame,draw_calls,vertices,buffer_binds,texture_binds,vertex_array_binds,program_switches,"
+                         "uniform_updates,buffer_bytes,texture_bytes,objects_created,objects_destroyed\n"
+                         "1,2,6,0,0,0,0,0,0,0,0,0\n"
+                         "2,3,9,0,0,0,0,0,0,0,0,0\n");
+}
@@ -0,0 +1,70 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/backend/gl_name_pool.h"
+#include "opengl-cpp/buffer.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+std::vector<id_buffer_t> make_buffer_ids(unsigned first, size_t n) {
+    std::vector<id_buffer_t> ret;
+    for (size_t i = 0; i < n; ++i) {
+        ret.emplace_back(first + i);
+    }
+    return ret;
+}
+
+} // namespace
+
+TEST(GlNamePoolTest, generatesInBatches) {
+    gl_mock_t gl;
+    constexpr size_t batch_size = 4;
+
+    EXPECT_CALL(gl, new_buffers(batch_size)).Times(Exactly(1)).WillOnce(Return(make_buffer_ids(1, batch_size)));
+    EXPECT_CALL(gl, new_buffers(7)).Times(Exactly(1)).WillOnce(Return(make_buffer_ids(5, 7)));
+    EXPECT_CALL(gl, destroy(_, A<const id_buffer_t *>())).Times(Exactly(0));
+
+    gl_name_pool_t pool(gl, batch_size);
+    EXPECT_EQ(pool.new_buffers(1)[0].get_id(), 4);
+    EXPECT_EQ(pool.new_buffers(3).size(), 3);
+
+    // More than a batch at once with the pool empty: the whole request is generated in one call.
+    EXPECT_EQ(pool.new_buffers(7).size(), 7);
+}
+
+TEST(GlNamePoolTest, deletesOnFlush) {
+    gl_mock_t gl;
+    gl_name_pool_t pool(gl, 8);
+
+    EXPECT_CALL(gl, new_buffers(8)).Times(Exactly(1)).WillOnce(Return(make_buffer_ids(1, 8)));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(0));
+
+    {
+        auto buffers = buffer_t::build(pool, 3);
+        EXPECT_EQ(pool.get_released(), 0);
+    }
+    EXPECT_EQ(pool.get_released(), 3);
+
+    std::vector<unsigned> deleted;
+    EXPECT_CALL(gl, destroy(3, A<const id_buffer_t *>()))
+        .Times(Exactly(1))
+        .WillOnce([&deleted](size_t n, const id_buffer_t *ids) {
+            for (size_t i = 0; i < n; ++i) {
+                deleted.push_back(ids[i].get_id());
+            }
+        });
+    pool.flush();
+    EXPECT_EQ(pool.get_released(), 0);
+    EXPECT_EQ(deleted.size(), 3);
+
+    // Names still pooled are deleted with the pool.
+    EXPECT_CALL(gl, destroy(5, A<const id_buffer_t *>())).Times(Exactly(1));
+}
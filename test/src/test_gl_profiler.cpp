@@ -0,0 +1,170 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/backend/gl_profiler.h"
+#include "opengl-cpp/buffer.h"
+#include "opengl-cpp/texture.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::AnyNumber;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+std::vector<id_query_t> make_query_ids(size_t n) {
+    std::vector<id_query_t> ret;
+    for (size_t i = 0; i < n; ++i) {
+        ret.emplace_back(static_cast<unsigned>(i + 1));
+    }
+    return ret;
+}
+
+void expect_create(gl_mock_t &gl, size_t queries) {
+    EXPECT_CALL(gl, new_queries(queries)).Times(Exactly(1)).WillOnce(Return(make_query_ids(queries)));
+    EXPECT_CALL(gl, get_timestamp()).Times(Exactly(1)).WillOnce(Return(1000));
+    EXPECT_CALL(gl, destroy(queries, A<const id_query_t *>())).Times(Exactly(1));
+}
+
+} // namespace
+
+TEST(GlProfilerTest, nestedScopes) {
+    gl_mock_t gl;
+    expect_create(gl, 4);
+
+    // The outer scope takes the first pair of queries, the inner one the second pair.
+    {
+        testing::InSequence sequence;
+        EXPECT_CALL(gl, query_counter(id_query_t(1))).Times(Exactly(1));
+        EXPECT_CALL(gl, query_counter(id_query_t(3))).Times(Exactly(1));
+        EXPECT_CALL(gl, draw_elements(6, index_type_t::unsigned_short, 0)).Times(Exactly(1));
+        EXPECT_CALL(gl, query_counter(id_query_t(4))).Times(Exactly(1));
+        EXPECT_CALL(gl, buffer_sub_data(_, 0, 64, _)).Times(Exactly(1));
+        EXPECT_CALL(gl, query_counter(id_query_t(2))).Times(Exactly(1));
+    }
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1}));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+    EXPECT_CALL(gl, is_query_result_available(_)).Times(AnyNumber()).WillRepeatedly(Return(true));
+    EXPECT_CALL(gl, get_query_result(id_query_t(1))).Times(Exactly(1)).WillOnce(Return(2000));
+    EXPECT_CALL(gl, get_query_result(id_query_t(2))).Times(Exactly(1)).WillOnce(Return(5000));
+    EXPECT_CALL(gl, get_query_result(id_query_t(3))).Times(Exactly(1)).WillOnce(Return(3000));
+    EXPECT_CALL(gl, get_query_result(id_query_t(4))).Times(Exactly(1)).WillOnce(Return(4000));
+
+    gl_profiler_t profiler(gl, 4);
+    buffer_t buffer(profiler, 0, buffer_target_t::simple_array);
+    {
+        const gl_profiler_t::scope_t frame(profiler, "frame");
+        {
+            const gl_profiler_t::scope_t pass(profiler, "pass");
+            profiler.draw_elements(6, index_type_t::unsigned_short, 0);
+        }
+        profiler.buffer_sub_data(buffer, 0, 64, nullptr);
+    }
+    EXPECT_EQ(profiler.get_pending(), 2);
+
+    const auto &events = profiler.get_events();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0].m_name, "pass");
+    EXPECT_EQ(events[0].m_depth, 1);
+    EXPECT_EQ(events[0].m_draws, 1);
+    EXPECT_EQ(events[0].m_uploads, 0);
+    EXPECT_EQ(events[1].m_name, "frame");
+    EXPECT_EQ(events[1].m_track, gl_profiler_t::track_t::cpu);
+    EXPECT_EQ(events[1].m_draws, 1);
+    EXPECT_EQ(events[1].m_upload_bytes, 64);
+    EXPECT_LE(events[1].m_start, events[0].m_start);
+    EXPECT_GE(events[1].m_duration, events[0].m_duration);
+
+    profiler.collect();
+    EXPECT_EQ(profiler.get_pending(), 0);
+    ASSERT_EQ(events.size(), 4);
+    EXPECT_EQ(events[2].m_name, "frame");
+    EXPECT_EQ(events[2].m_track, gl_profiler_t::track_t::gpu);
+    EXPECT_EQ(events[2].m_duration, 3000);
+    EXPECT_EQ(events[2].m_upload_bytes, 64);
+    EXPECT_EQ(events[3].m_name, "pass");
+    EXPECT_EQ(events[3].m_depth, 1);
+    EXPECT_EQ(events[3].m_start - events[2].m_start, 1000);
+}
+
+TEST(GlProfilerTest, collectDoesNotWait) {
+    gl_mock_t gl;
+    expect_create(gl, 2);
+    EXPECT_CALL(gl, query_counter(_)).Times(Exactly(2));
+    EXPECT_CALL(gl, get_query_result(_)).Times(Exactly(0));
+
+    gl_profiler_t profiler(gl, 2);
+    profiler.begin_scope("first");
+    profiler.end_scope();
+
+    // The only pair of queries is still in flight, so the next scope is only timed on the CPU.
+    EXPECT_CALL(gl, is_query_result_available(id_query_t(2))).Times(Exactly(2)).WillRepeatedly(Return(false));
+    profiler.begin_scope("second");
+    profiler.end_scope();
+    profiler.collect();
+    EXPECT_EQ(profiler.get_pending(), 1);
+    EXPECT_EQ(profiler.get_dropped(), 1);
+    EXPECT_EQ(profiler.get_events().size(), 2);
+}
+
+TEST(GlProfilerTest, textureUploadBytes) {
+    gl_mock_t gl;
+    expect_create(gl, 2);
+    EXPECT_CALL(gl, query_counter(_)).Times(Exactly(2));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+    EXPECT_CALL(gl, set_image(_, 4, 2, texture_format_t::rgb, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 0, 0, 2, 2, texture_format_t::rgba, pixel_type_t::half_float, _))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image_3d(_, 0, 0, 0, 1, 2, 2, 3, texture_format_t::red, pixel_type_t::single_float, _))
+        .Times(Exactly(1));
+
+    const std::vector<unsigned char> pixels(24);
+    gl_profiler_t profiler(gl, 2);
+    {
+        const texture_t texture(profiler, 0, texture_target_t::tex_2d, 3);
+        const gl_profiler_t::scope_t upload(profiler, "upload");
+        profiler.set_image(texture, 4, 2, texture_format_t::rgb, pixels.data());
+        profiler.set_sub_image(texture, 0, 0, 0, 2, 2, texture_format_t::rgba, pixel_type_t::half_float, nullptr);
+        profiler.set_sub_image_3d(texture, 0, 0, 0, 1, 2, 2, 3, texture_format_t::red, pixel_type_t::single_float,
+                                  nullptr);
+    }
+
+    const auto &events = profiler.get_events();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].m_uploads, 3);
+    EXPECT_EQ(events[0].m_upload_bytes, 24 + 32 + 48);
+}
+
+TEST(GlProfilerTest, chromeTrace) {
+    gl_mock_t gl;
+    expect_create(gl, 2);
+    EXPECT_CALL(gl, query_counter(_)).Times(Exactly(2));
+    EXPECT_CALL(gl, is_query_result_available(_)).Times(AnyNumber()).WillRepeatedly(Return(true));
+    EXPECT_CALL(gl, get_query_result(id_query_t(1))).Times(Exactly(1)).WillOnce(Return(1500));
+    EXPECT_CALL(gl, get_query_result(id_query_t(2))).Times(Exactly(1)).WillOnce(Return(4000));
+
+    gl_profiler_t profiler(gl, 2);
+    profiler.begin_scope("shadow \"pass\"");
+    profiler.end_scope();
+    profiler.collect();
+
+    std::ostringstream trace;
+    trace << 1.5;
+    profiler.write_trace(trace);
+    const auto json = trace.str();
+    EXPECT_EQ(json.rfind("1.5{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0);
+    EXPECT_NE(json.find(R"("name":"thread_name","ph":"M","pid":1,"tid":2,"args":{"name":"GPU"})"), std::string::npos);
+    EXPECT_NE(json.find(R"({"name":"shadow \"pass\"","ph":"X","pid":1,"tid":1,"ts":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("tid":2,"ts":)"), std::string::npos);
+    EXPECT_NE(json.find(R"("dur":2.500,"args":{"draws":0,"uploads":0,"upload_bytes":0}})"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 4), "\n]}\n");
+
+    profiler.clear();
+    EXPECT_TRUE(profiler.get_events().empty());
+}
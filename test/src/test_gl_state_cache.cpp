@@ -0,0 +1,115 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/backend/gl_state_cache.h"
+#include "opengl-cpp/buffer.h"
+#include "opengl-cpp/program.h"
+#include "opengl-cpp/texture.h"
+#include "opengl-cpp/vertex_array.h"
+#include "gtest/gtest.h"
+
+using ::testing::A;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+TEST(GlStateCacheTest, bufferBindSkipsRedundant) {
+    gl_mock_t gl;
+    gl_state_cache_t cache(gl);
+
+    buffer_t b1(gl, 1, buffer_target_t::simple_array);
+    buffer_t b2(gl, 2, buffer_target_t::simple_array);
+    buffer_t b3(gl, 3, buffer_target_t::element_array);
+
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(4));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(3));
+
+    cache.bind(b1);
+    cache.bind(b1);
+    cache.bind(b3);
+    cache.bind(b3);
+    cache.bind(b2);
+    cache.bind(b1);
+}
+
+TEST(GlStateCacheTest, bufferDestroyForgetsBinding) {
+    gl_mock_t gl;
+    gl_state_cache_t cache(gl);
+
+    const id_buffer_t id = 1;
+
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(2));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(2));
+
+    buffer_t b1(gl, 1, buffer_target_t::simple_array);
+    cache.bind(b1);
+    cache.destroy(1, &id);
+
+    // A new buffer reusing the deleted name must be bound again.
+    cache.bind(b1);
+}
+
+TEST(GlStateCacheTest, vertexArrayBindForgetsElementArray) {
+    gl_mock_t gl;
+    gl_state_cache_t cache(gl);
+
+    EXPECT_CALL(gl, new_buffers(2)).Times(Exactly(2)).WillRepeatedly(Return(std::vector<id_buffer_t>{1, 2}));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(5));
+    EXPECT_CALL(gl, destroy(1, A<const id_vertex_array_t *>())).Times(Exactly(2));
+
+    vertex_array_t va1(gl, 1);
+    vertex_array_t va2(gl, 2);
+    buffer_t indices(gl, 3, buffer_target_t::element_array);
+
+    EXPECT_CALL(gl, bind(A<const vertex_array_t &>())).Times(Exactly(2));
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(2));
+
+    cache.bind(va1);
+    cache.bind(indices);
+    cache.bind(va1);
+    cache.bind(indices);
+    cache.bind(va2);
+    cache.bind(indices);
+}
+
+TEST(GlStateCacheTest, textureBindTracksUnits) {
+    gl_mock_t gl;
+    gl_state_cache_t cache(gl);
+
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(3));
+
+    texture_t t1(gl, 0, texture_target_t::tex_2d, 1);
+    texture_t t2(gl, 1, texture_target_t::tex_2d, 2);
+    texture_t t3(gl, 0, texture_target_t::tex_2d, 3);
+
+    EXPECT_CALL(gl, activate(A<const texture_t &>())).Times(Exactly(3));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(3));
+
+    cache.activate(t1);
+    cache.bind(t1);
+    cache.activate(t1);
+    cache.bind(t1);
+    cache.activate(t2);
+    cache.bind(t2);
+    cache.activate(t1);
+    cache.bind(t1);
+    cache.bind(t3);
+}
+
+TEST(GlStateCacheTest, useSkipsRedundant) {
+    gl_mock_t gl;
+    gl_state_cache_t cache(gl);
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(5)));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p(gl);
+
+    EXPECT_CALL(gl, use(A<const program_t &>())).Times(Exactly(2));
+
+    cache.use(p);
+    cache.use(p);
+    cache.invalidate();
+    cache.use(p);
+}
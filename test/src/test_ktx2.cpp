@@ -0,0 +1,122 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/ktx2.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+using testing::_;
+using testing::A;
+using testing::Exactly;
+using testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+constexpr uint32_t vk_format_bc1_rgba = 133;
+constexpr uint32_t vk_format_rgba8 = 37;
+constexpr uint32_t vk_format_rgba32f = 109;
+
+template <class type_t> void put(std::vector<unsigned char> &file, size_t offset, type_t value) {
+    std::memcpy(file.data() + offset, &value, sizeof(value));
+}
+
+// Writes a 2D KTX2 file whose levels are filled with their index, stored from the smallest to the base one.
+std::filesystem::path write_ktx2(const std::string &name, uint32_t vk_format, uint32_t width, uint32_t height,
+                                 uint32_t level_count, const std::vector<size_t> &level_sizes) {
+    constexpr size_t header_size = 80;
+    constexpr size_t entry_size = 24;
+    const unsigned char identifier[] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, 0x0D, 0x0A, 0x1A, 0x0A}; // NOLINT
+
+    std::vector<unsigned char> file(header_size + level_sizes.size() * entry_size);
+    std::memcpy(file.data(), identifier, sizeof(identifier));
+    put<uint32_t>(file, 12, vk_format);
+    put<uint32_t>(file, 20, width);
+    put<uint32_t>(file, 24, height);
+    put<uint32_t>(file, 36, 1);
+    put<uint32_t>(file, 40, level_count);
+
+    for (size_t level = level_sizes.size(); level-- > 0;) {
+        const auto entry = header_size + level * entry_size;
+        put<uint64_t>(file, entry, file.size());
+        put<uint64_t>(file, entry + 8, level_sizes[level]);
+        put<uint64_t>(file, entry + 16, level_sizes[level]);
+        file.insert(file.end(), level_sizes[level], static_cast<unsigned char>(level));
+    }
+
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char *>(file.data()), // NOLINT
+                                                static_cast<std::streamsize>(file.size()));
+    return path;
+}
+
+} // namespace
+
+TEST(Ktx2Test, loadCompressedLevels) {
+    gl_mock_t gl;
+    const auto path = write_ktx2("opengl_cpp_bc1.ktx2", vk_format_bc1_rgba, 8, 8, 2, {32, 8});
+    const ktx2_file_t file(path);
+
+    EXPECT_EQ(file.get_width(), 8);
+    EXPECT_EQ(file.get_height(), 8);
+    EXPECT_EQ(file.get_levels(), 2);
+    EXPECT_EQ(file.get_format(), texture_internal_format_t::bc1_rgba);
+    EXPECT_EQ(file.get_level_data(1), std::string(8, '\1'));
+
+    constexpr auto format = texture_internal_format_t::bc1_rgba;
+    const auto *level0 = static_cast<const void *>(file.get_level_data(0).data());
+    const auto *level1 = static_cast<const void *>(file.get_level_data(1).data());
+    EXPECT_CALL(gl, has_extension(extension_t::texture_compression_s3tc)).Times(Exactly(1)).WillOnce(Return(true));
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_texture_t>{3}));
+    EXPECT_CALL(gl, activate(_)).Times(Exactly(1));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, texture_storage(_, 2, format, 8, 8)).Times(Exactly(1));
+    EXPECT_CALL(gl, compressed_sub_image(_, 0, 0, 0, 8, 8, format, 32, level0)).Times(Exactly(1));
+    EXPECT_CALL(gl, compressed_sub_image(_, 1, 0, 0, 4, 4, format, 8, level1)).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    const auto texture = file.load(gl, 0);
+    EXPECT_EQ(texture.get_levels(), 2);
+}
+
+TEST(Ktx2Test, generateMipmap) {
+    gl_mock_t gl;
+    const auto path = write_ktx2("opengl_cpp_rgba8.ktx2", vk_format_rgba8, 4, 2, 0, {32});
+    const ktx2_file_t file(path);
+
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_texture_t>{3}));
+    EXPECT_CALL(gl, activate(_)).Times(Exactly(1));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, texture_storage(_, 3, texture_internal_format_t::rgba8, 4, 2)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 0, 0, 4, 2, texture_format_t::rgba, pixel_type_t::unsigned_byte, _))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, generate_mipmap(_)).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    const auto texture = file.load(gl, 0);
+    EXPECT_EQ(texture.get_levels(), 3);
+}
+
+TEST(Ktx2Test, invalidFiles) {
+    gl_mock_t gl;
+
+    EXPECT_THROW(ktx2_file_t("./missing.ktx2"), std::runtime_error);
+    EXPECT_THROW(ktx2_file_t(write_ktx2("opengl_cpp_format.ktx2", 1, 4, 4, 1, {64})), std::runtime_error);
+    EXPECT_THROW(ktx2_file_t(write_ktx2("opengl_cpp_size.ktx2", vk_format_rgba8, 4, 4, 1, {32})), std::runtime_error);
+    EXPECT_THROW(ktx2_file_t(write_ktx2("opengl_cpp_levels.ktx2", vk_format_rgba8, 1, 1, 2, {4, 4})),
+                 std::runtime_error);
+    EXPECT_THROW(ktx2_file_t(write_ktx2("opengl_cpp_width.ktx2", vk_format_rgba8, 0, 4, 1, {0})), std::runtime_error);
+
+    // 2^31 x 2^31 texels of 16 bytes wrap around to a size of 0.
+    constexpr uint32_t huge = 1U << 31U;
+    EXPECT_THROW(ktx2_file_t(write_ktx2("opengl_cpp_huge.ktx2", vk_format_rgba32f, huge, huge, 1, {0})),
+                 std::runtime_error);
+
+    const ktx2_file_t file(write_ktx2("opengl_cpp_s3tc.ktx2", vk_format_bc1_rgba, 4, 4, 1, {8}));
+    EXPECT_CALL(gl, has_extension(extension_t::texture_compression_s3tc)).Times(Exactly(1)).WillOnce(Return(false));
+    EXPECT_THROW(static_cast<void>(file.load(gl, 0)), std::runtime_error);
+}
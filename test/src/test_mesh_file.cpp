@@ -0,0 +1,138 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/mesh_file.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+using testing::_;
+using testing::A;
+using testing::AnyNumber;
+using testing::Exactly;
+using testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+const std::vector<vertex_t> quad = {
+    {glm::vec3(-1.0F, 0.0F, 2.0F), glm::vec2(0.0F, 0.0F), glm::vec3(0.0F, 0.0F, 1.0F)},
+    {glm::vec3(1.0F, 0.0F, 2.0F), glm::vec2(1.0F, 0.0F), glm::vec3(0.0F, 0.0F, 1.0F)},
+    {glm::vec3(1.0F, 3.0F, 2.0F), glm::vec2(1.0F, 1.0F), glm::vec3(0.0F, 0.0F, 1.0F)},
+    {glm::vec3(-1.0F, 3.0F, 2.0F), glm::vec2(0.0F, 1.0F), glm::vec3(0.0F, 0.0F, 1.0F)},
+};
+
+// Overwrites a 32-bit field of a file.
+void patch(const std::filesystem::path &path, size_t offset, uint32_t value) {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value)); // NOLINT(*-reinterpret-cast)
+}
+
+} // namespace
+
+TEST(MeshFileTest, roundTrip) {
+    const auto path = std::filesystem::temp_directory_path() / "opengl_cpp_quad.mesh";
+    mesh_file_t::write(path, quad, {0, 1, 2, 2, 3, 0}, {{0, 3}, {3, 3}});
+
+    const mesh_file_t file(path);
+    EXPECT_EQ(file.get_vertex_count(), 4);
+    EXPECT_EQ(file.get_index_count(), 6);
+    EXPECT_EQ(file.get_index_type(), index_type_t::unsigned_short);
+    EXPECT_EQ(file.get_stride(), sizeof(vertex_t));
+    ASSERT_EQ(file.get_attributes().size(), 3);
+    EXPECT_EQ(file.get_attributes()[1].m_location, 1);
+    EXPECT_EQ(file.get_attributes()[1].m_components, 2);
+    EXPECT_EQ(file.get_attributes()[2].m_offset, offsetof(vertex_t, m_nor));
+    EXPECT_EQ(file.get_bounds_min(), glm::vec3(-1.0F, 0.0F, 2.0F));
+    EXPECT_EQ(file.get_bounds_max(), glm::vec3(1.0F, 3.0F, 2.0F));
+    ASSERT_EQ(file.get_submeshes().size(), 2);
+    EXPECT_EQ(file.get_submeshes()[1].m_first, 3);
+
+    // Payloads are aligned in the mapping, and hold the data as it is uploaded.
+    const auto vertices = file.get_vertex_data();
+    const auto indices = file.get_index_data();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(vertices.data()) % mesh_file_t::payload_alignment, 0); // NOLINT
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(indices.data()) % mesh_file_t::payload_alignment, 0);  // NOLINT
+    ASSERT_EQ(vertices.size(), quad.size() * sizeof(vertex_t));
+    EXPECT_EQ(std::memcmp(vertices.data(), quad.data(), vertices.size()), 0);
+    const std::vector<uint16_t> expected_indices = {0, 1, 2, 2, 3, 0};
+    ASSERT_EQ(indices.size(), 12);
+    EXPECT_EQ(std::memcmp(indices.data(), expected_indices.data(), indices.size()), 0);
+}
+
+TEST(MeshFileTest, loadFromMapping) {
+    gl_mock_t gl;
+    const auto path = std::filesystem::temp_directory_path() / "opengl_cpp_load.mesh";
+    mesh_file_t::write(path, quad, {0, 1, 2, 2, 3, 0}, {{0, 3}, {3, 3}});
+    const mesh_file_t file(path);
+
+    const auto *vertices = static_cast<const void *>(file.get_vertex_data().data());
+    const auto *indices = static_cast<const void *>(file.get_index_data().data());
+    EXPECT_CALL(gl, new_vertex_arrays(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_vertex_array_t>{1}));
+    EXPECT_CALL(gl, new_buffers(2)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1, 2}));
+    EXPECT_CALL(gl, bind(A<const vertex_array_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, buffer_data(_, 4 * sizeof(vertex_t), vertices, buffer_usage_t::static_draw)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, 12, indices, buffer_usage_t::static_draw)).Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(0, 3, vertex_attrib_type_t::single_float, false, sizeof(vertex_t), 0))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(1, 2, vertex_attrib_type_t::single_float, false, sizeof(vertex_t), 12))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(2, 3, vertex_attrib_type_t::single_float, false, sizeof(vertex_t), 20))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, enable_vertex_attrib_array(_)).Times(Exactly(3));
+    EXPECT_CALL(gl, draw_elements(3, index_type_t::unsigned_short, 6)).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(2));
+    EXPECT_CALL(gl, destroy(1, A<const id_vertex_array_t *>())).Times(Exactly(1));
+
+    const auto va = file.load(gl);
+    EXPECT_EQ(va.get_index_count(), 6);
+    const auto &submesh = file.get_submeshes()[1];
+    va.draw(submesh.m_first, submesh.m_count);
+}
+
+TEST(MeshFileTest, withoutIndices) {
+    const auto path = std::filesystem::temp_directory_path() / "opengl_cpp_soup.mesh";
+    mesh_file_t::write(path, quad, {});
+
+    const mesh_file_t file(path);
+    EXPECT_EQ(file.get_index_type(), index_type_t::undefined);
+    EXPECT_TRUE(file.get_index_data().empty());
+    ASSERT_EQ(file.get_submeshes().size(), 1);
+    EXPECT_EQ(file.get_submeshes()[0].m_count, 4);
+}
+
+TEST(MeshFileTest, invalidFiles) {
+    EXPECT_THROW(mesh_file_t("./missing.mesh"), std::runtime_error);
+    EXPECT_THROW(mesh_file_t("./shader.vert"), std::runtime_error);
+
+    const auto path = std::filesystem::temp_directory_path() / "opengl_cpp_invalid.mesh";
+    mesh_file_t::write(path, quad, {0, 1, 2, 2, 3, 0});
+    patch(path, 4, mesh_file_t::version + 1);
+    EXPECT_THROW(mesh_file_t{path}, std::runtime_error);
+
+    mesh_file_t::write(path, quad, {0, 1, 2, 2, 3, 0});
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 2);
+    EXPECT_THROW(mesh_file_t{path}, std::runtime_error);
+
+    constexpr size_t submesh_table_offset = 400;
+    mesh_file_t::write(path, quad, {0, 1, 2, 2, 3, 0});
+    patch(path, submesh_table_offset, 4);
+    EXPECT_THROW(mesh_file_t{path}, std::runtime_error);
+
+    // The three floats of the position would end past the 32 bytes of a vertex.
+    constexpr size_t first_attribute_offset = 96;
+    mesh_file_t::write(path, quad, {0, 1, 2, 2, 3, 0});
+    patch(path, first_attribute_offset, 24);
+    EXPECT_THROW(mesh_file_t{path}, std::runtime_error);
+}
+
+TEST(MeshFileTest, writeIndexOutOfRange) {
+    const auto path = std::filesystem::temp_directory_path() / "opengl_cpp_out_of_range.mesh";
+    EXPECT_THROW(mesh_file_t::write(path, quad, {0, 1, 4}), std::out_of_range);
+    EXPECT_THROW(mesh_file_t::write(path, quad, {0, 1, 65536}), std::out_of_range);
+}
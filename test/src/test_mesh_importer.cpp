@@ -0,0 +1,157 @@
+#include "opengl-cpp/mesh_importer.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+using namespace opengl_cpp; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+constexpr std::string_view quad_obj = "# Quad split in two triangles sharing their diagonal corners.\n"
+                                      "o quad\n"
+                                      "v 0 0 0\n"
+                                      "v 1 0 0\n"
+                                      "v 1 1 0\r\n"
+                                      "v 0 1 0\n"
+                                      "vt 0 0\n"
+                                      "vt 1 0\n"
+                                      "vt 1 1\n"
+                                      "vt 0 1\n"
+                                      "vn 0 0 1\n"
+                                      "f 1/1/1 2/2/1 3/3/1 4/4/1\n"
+                                      "f -4/-4/-1 -2/-2/-1 -1/-1/-1\n";
+
+template <class type_t> void append(std::string &data, type_t value) {
+    data.append(reinterpret_cast<const char *>(&value), sizeof(value)); // NOLINT(*-reinterpret-cast)
+}
+
+// One triangle with positions and 16-bit indices, the second index being shifted by the buffer view offset. Every
+// primitive draws that same triangle. count is the JSON number of positions, extras any JSON value importers ignore.
+std::string make_glb(size_t primitives = 1, const std::string &count = "3", const std::string &extras = "null") {
+    std::string bin;
+    for (const float f : {0.0F, 0.0F, 0.0F, 1.0F, 0.0F, 0.0F, 0.0F, 1.0F, 0.0F}) {
+        append(bin, f);
+    }
+    for (const uint16_t i : {2, 1, 0}) {
+        append(bin, i);
+    }
+    bin.resize(44, '\0');
+
+    std::string json = R"({"asset": {"version": "2.0"}, "extras": )" + extras + R"(,
+        "buffers": [{"byteLength": 44}],
+        "bufferViews": [{"buffer": 0, "byteOffset": 0, "byteLength": 36},
+                        {"buffer": 0, "byteOffset": 36, "byteLength": 6}],
+        "accessors": [{"bufferView": 0, "componentType": 5126, "count": )" + count + R"(, "type": "VEC3"},
+                      {"bufferView": 1, "componentType": 5123, "count": 3, "type": "SCALAR"}],
+        "meshes": [{"primitives": [)";
+    for (size_t i = 0; i < primitives; ++i) {
+        json += i == 0 ? "" : ", ";
+        json += R"({"attributes": {"POSITION": 0}, "indices": 1, "mode": 4})";
+    }
+    json += "]}]}";
+    json.resize((json.size() + 3) / 4 * 4, ' ');
+
+    std::string glb;
+    append<uint32_t>(glb, 0x46546C67);
+    append<uint32_t>(glb, 2);
+    append<uint32_t>(glb, static_cast<uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+    append<uint32_t>(glb, static_cast<uint32_t>(json.size()));
+    append<uint32_t>(glb, 0x4E4F534A);
+    glb += json;
+    append<uint32_t>(glb, static_cast<uint32_t>(bin.size()));
+    append<uint32_t>(glb, 0x004E4942);
+    glb += bin;
+    return glb;
+}
+
+} // namespace
+
+TEST(MeshImporterTest, objQuad) {
+    const mesh_importer_t importer(1);
+    const auto mesh = importer.import_obj(quad_obj);
+
+    // Both faces cover the same quad, so they share all four corners.
+    ASSERT_EQ(mesh.m_vertices.size(), 4);
+    EXPECT_EQ(mesh.m_indices, std::vector<unsigned>({0, 1, 2, 0, 2, 3, 0, 2, 3}));
+    EXPECT_EQ(mesh.m_vertices[2].m_pos, glm::vec3(1.0F, 1.0F, 0.0F));
+    EXPECT_EQ(mesh.m_vertices[3].m_tex[1], 1.0F);
+    EXPECT_EQ(mesh.m_vertices[1].m_nor, glm::vec3(0.0F, 0.0F, 1.0F));
+}
+
+TEST(MeshImporterTest, objChunksMatchSerialParse) {
+    std::string obj;
+    for (int i = 0; i < 100; ++i) {
+        const auto x = std::to_string(i) + ".5";
+        obj += "v " + x + " 0 -1e-1\nv " + x + " 1 2.5E1\nv " + x + " 2 0\nvn 0 1 0\n";
+        obj += "f -3//-1 -2//-1 -1//-1\n";
+    }
+
+    const auto serial = mesh_importer_t(1).import_obj(obj);
+    const auto chunked = mesh_importer_t(7).import_obj(obj);
+    ASSERT_EQ(serial.m_vertices.size(), 300);
+    EXPECT_EQ(chunked.m_indices, serial.m_indices);
+    ASSERT_EQ(chunked.m_vertices.size(), serial.m_vertices.size());
+    for (size_t i = 0; i < serial.m_vertices.size(); ++i) {
+        EXPECT_EQ(chunked.m_vertices[i].m_pos, serial.m_vertices[i].m_pos);
+    }
+    EXPECT_EQ(serial.m_vertices[298].m_pos, glm::vec3(99.5F, 1.0F, 25.0F));
+    EXPECT_EQ(serial.m_vertices[0].m_pos, glm::vec3(0.5F, 0.0F, -0.1F));
+}
+
+TEST(MeshImporterTest, objInvalidFaces) {
+    const mesh_importer_t importer(2);
+    EXPECT_THROW(static_cast<void>(importer.import_obj("v 0 0 0\nf 1 1\n")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(importer.import_obj("v 0 0 0\nf 1 2 3\n")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(importer.import_obj("v 0 0 0\nf -2 1 1\n")), std::runtime_error);
+}
+
+TEST(MeshImporterTest, glb) {
+    const mesh_importer_t importer(2);
+    const auto mesh = importer.import_glb(make_glb());
+
+    ASSERT_EQ(mesh.m_vertices.size(), 3);
+    EXPECT_EQ(mesh.m_indices, std::vector<unsigned>({2, 1, 0}));
+    EXPECT_EQ(mesh.m_vertices[1].m_pos, glm::vec3(1.0F, 0.0F, 0.0F));
+    EXPECT_EQ(mesh.m_vertices[2].m_pos, glm::vec3(0.0F, 1.0F, 0.0F));
+
+    auto truncated = make_glb();
+    truncated.resize(truncated.size() - 8);
+    EXPECT_THROW(static_cast<void>(importer.import_glb(truncated)), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(importer.import_glb("not a glb file")), std::runtime_error);
+}
+
+TEST(MeshImporterTest, glbInvalidJson) {
+    const mesh_importer_t importer(1);
+    EXPECT_NO_THROW(static_cast<void>(importer.import_glb(make_glb(1, "3.0", "[[[{}]]]"))));
+
+    const auto nested = std::string(10000, '[') + std::string(10000, ']');
+    EXPECT_THROW(static_cast<void>(importer.import_glb(make_glb(1, "3", nested))), std::runtime_error);
+    for (const auto *count : {"-1", "1.5", "1e300", "18446744073709551616"}) {
+        EXPECT_THROW(static_cast<void>(importer.import_glb(make_glb(1, count))), std::runtime_error) << count;
+    }
+}
+
+TEST(MeshImporterTest, glbManyPrimitives) {
+    // More primitives than threads, so the ranges of the threads start and end inside primitives.
+    constexpr size_t primitives = 7;
+    const mesh_importer_t importer(3);
+    const auto mesh = importer.import_glb(make_glb(primitives));
+
+    ASSERT_EQ(mesh.m_vertices.size(), primitives * 3);
+    ASSERT_EQ(mesh.m_indices.size(), primitives * 3);
+    for (size_t i = 0; i < primitives; ++i) {
+        const auto first = static_cast<unsigned>(i * 3);
+        EXPECT_EQ(mesh.m_indices[i * 3], first + 2);
+        EXPECT_EQ(mesh.m_indices[i * 3 + 1], first + 1);
+        EXPECT_EQ(mesh.m_indices[i * 3 + 2], first);
+        EXPECT_EQ(mesh.m_vertices[i * 3 + 1].m_pos, glm::vec3(1.0F, 0.0F, 0.0F));
+    }
+}
+
+TEST(MeshImporterTest, unknownFormat) {
+    const mesh_importer_t importer;
+    EXPECT_GE(importer.get_threads(), 1);
+    EXPECT_THROW(static_cast<void>(importer.import("./shader.vert")), std::runtime_error);
+}
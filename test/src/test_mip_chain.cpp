@@ -0,0 +1,112 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/mip_chain.h"
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+
+using testing::_;
+using testing::A;
+using testing::Exactly;
+using testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+TEST(MipChainTest, boxFilter) {
+    // 4x2 RGBA, each 2x2 block averages to a known colour.
+    const std::vector<unsigned char> pixels = {
+        0,   0,   0,   0,   255, 255, 255, 255, 10, 20, 30, 40, 10, 20, 30, 40, //
+        255, 255, 255, 255, 0,   0,   0,   0,   30, 40, 50, 60, 30, 40, 50, 60, //
+    };
+    const mip_chain_t chain({pixels.data(), 4, 2, 4, false});
+
+    ASSERT_EQ(chain.get_levels(), 3);
+    EXPECT_EQ(chain.get_level(0).m_data, pixels);
+
+    const auto &level1 = chain.get_level(1);
+    EXPECT_EQ(level1.m_width, 2);
+    EXPECT_EQ(level1.m_height, 1);
+    EXPECT_EQ(level1.m_data, std::vector<unsigned char>({128, 128, 128, 128, 20, 30, 40, 50}));
+
+    const auto &level2 = chain.get_level(2);
+    EXPECT_EQ(level2.m_width, 1);
+    EXPECT_EQ(level2.m_data, std::vector<unsigned char>({74, 79, 84, 89}));
+}
+
+TEST(MipChainTest, srgbIsFilteredInLinearSpace) {
+    // Black and white average to linear grey, which is brighter once encoded back. Alpha is averaged as is.
+    const std::vector<unsigned char> pixels = {0, 0, 0, 0, 255, 255, 255, 255};
+    const mip_chain_t chain({pixels.data(), 2, 1, 4, true});
+
+    EXPECT_EQ(chain.get_internal_format(), texture_internal_format_t::srgb8_alpha8);
+    EXPECT_EQ(chain.get_level(1).m_data, std::vector<unsigned char>({188, 188, 188, 128}));
+}
+
+TEST(MipChainTest, kaiserKeepsFlatImages) {
+    // Single channel rows are padded to 4 bytes.
+    constexpr size_t size = 6;
+    constexpr size_t stride = 8;
+    const std::vector<unsigned char> pixels(stride * size, 100);
+    const mip_chain_t chain({pixels.data(), size, size, 1, false}, mip_filter_t::kaiser);
+
+    ASSERT_EQ(chain.get_levels(), 3);
+    EXPECT_EQ(chain.get_format(), texture_format_t::red);
+    EXPECT_EQ(chain.get_level(1).m_stride, 4);
+    EXPECT_EQ(chain.get_level(1).m_data,
+              std::vector<unsigned char>({100, 100, 100, 0, 100, 100, 100, 0, 100, 100, 100, 0}));
+    EXPECT_EQ(chain.get_level(2).m_data, std::vector<unsigned char>({100, 0, 0, 0}));
+}
+
+TEST(MipChainTest, buildInParallel) {
+    std::vector<std::vector<unsigned char>> pixels;
+    std::vector<mip_image_t> images;
+    for (unsigned char i = 0; i < 5; ++i) {
+        pixels.emplace_back(8 * 8 * 4, i);
+    }
+    for (const auto &p : pixels) {
+        images.push_back({p.data(), 8, 8, 4, false});
+    }
+
+    const auto chains = mip_chain_t::build(images, mip_filter_t::kaiser, 0, 3);
+    ASSERT_EQ(chains.size(), images.size());
+    for (size_t i = 0; i < chains.size(); ++i) {
+        ASSERT_EQ(chains[i].get_levels(), 4);
+        EXPECT_EQ(chains[i].get_level(3).m_data, std::vector<unsigned char>(4, i));
+    }
+
+    const auto partial = mip_chain_t::build(images, mip_filter_t::box, 2, 3);
+    ASSERT_EQ(partial.size(), images.size());
+    for (const auto &chain : partial) {
+        EXPECT_EQ(chain.get_levels(), 2);
+    }
+}
+
+TEST(MipChainTest, buildRethrowsOnCallingThread) {
+    const std::vector<unsigned char> pixels(8 * 8 * 4);
+    std::vector<mip_image_t> images(4, {pixels.data(), 8, 8, 4, false});
+
+    // The base level of an image this wide cannot be allocated.
+    images[2] = {pixels.data(), size_t{1} << 63U, 1, 1, false};
+    EXPECT_THROW(mip_chain_t::build(images, mip_filter_t::box, 1, 2), std::length_error);
+}
+
+TEST(MipChainTest, upload) {
+    gl_mock_t gl;
+    const std::vector<unsigned char> pixels(4 * 4 * 3);
+    const mip_chain_t chain({pixels.data(), 4, 4, 3, true});
+
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_texture_t>{3}));
+    EXPECT_CALL(gl, texture_storage(_, 2, texture_internal_format_t::srgb8, 4, 4)).Times(Exactly(1));
+    for (int level = 0; level < 2; ++level) {
+        const auto size = static_cast<size_t>(4 >> level);
+        const auto *data = static_cast<const void *>(chain.get_level(level).m_data.data());
+        EXPECT_CALL(gl, set_sub_image(_, level, 0, 0, size, size, texture_format_t::rgb, _, data)).Times(Exactly(1));
+    }
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    // Only the levels allocated are uploaded.
+    texture_t texture(gl, 0, texture_target_t::tex_2d);
+    texture.allocate(4, 4, chain.get_internal_format(), 2);
+    chain.upload(texture);
+}
@@ -0,0 +1,152 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/program.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using testing::_;
+using testing::A;
+using testing::Exactly;
+using testing::Return;
+using testing::StrEq;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+void expect_link(gl_mock_t &gl, const std::vector<std::pair<std::string, int>> &uniforms) {
+    EXPECT_CALL(gl, link(A<const program_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_TRUE));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::active_uniforms))
+        .Times(Exactly(1))
+        .WillOnce(Return(static_cast<int>(uniforms.size())));
+
+    for (unsigned i = 0; i < uniforms.size(); ++i) {
+        EXPECT_CALL(gl, get_active_uniform(A<const program_t &>(), i))
+            .Times(Exactly(1))
+            .WillOnce(Return(uniforms[i].first));
+        EXPECT_CALL(gl, get_uniform_location(A<const program_t &>(), StrEq(uniforms[i].first)))
+            .Times(Exactly(1))
+            .WillOnce(Return(uniforms[i].second));
+    }
+}
+
+} // namespace
+
+TEST(ProgramTest, linkFailed) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    EXPECT_CALL(gl, link(A<const program_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_FALSE));
+    EXPECT_CALL(gl, get_info_log(A<const program_t &>())).Times(Exactly(1)).WillOnce(Return("error string"));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p(gl);
+    EXPECT_THROW(p.link(), std::runtime_error);
+}
+
+TEST(ProgramTest, setUniformUsesTable) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    expect_link(gl, {{"model", 3}, {"lights[0]", 5}, {"block_member", -1}});
+    EXPECT_CALL(gl, set_uniform(3, A<float>())).Times(Exactly(2));
+    EXPECT_CALL(gl, set_uniform(5, A<int>())).Times(Exactly(2));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p(gl);
+    p.link();
+
+    p.set_uniform("model", 1.0F);
+    p.set_uniform(std::string("model"), 2.0F);
+    p.set_uniform("lights", 1);
+    p.set_uniform("lights[0]", 2);
+    EXPECT_EQ(p.get_uniform_location("block_member"), -1);
+}
+
+TEST(ProgramTest, uniformHandle) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    expect_link(gl, {{"model", 3}});
+    EXPECT_CALL(gl, set_uniform(3, A<const glm::vec3 &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p(gl);
+    p.link();
+
+    const auto model = p.get_uniform("model");
+    EXPECT_TRUE(model);
+    EXPECT_EQ(model.get_location(), 3);
+    p.set_uniform(model, glm::vec3(1.0F));
+}
+
+TEST(ProgramTest, unlistedUniformQueriedOnce) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    expect_link(gl, {{"lights[0]", 5}});
+    EXPECT_CALL(gl, get_uniform_location(A<const program_t &>(), StrEq("lights[2]")))
+        .Times(Exactly(1))
+        .WillOnce(Return(7));
+    EXPECT_CALL(gl, get_uniform_location(A<const program_t &>(), StrEq("missing")))
+        .Times(Exactly(1))
+        .WillOnce(Return(-1));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p(gl);
+    p.link();
+
+    EXPECT_EQ(p.get_uniform_location("lights[2]"), 7);
+    EXPECT_EQ(p.get_uniform_location("lights[2]"), 7);
+    EXPECT_FALSE(p.get_uniform("missing"));
+    EXPECT_FALSE(p.get_uniform("missing"));
+}
+
+TEST(ProgramTest, unlistedUniformQueriedOnceAcrossThreads) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    expect_link(gl, {});
+    EXPECT_CALL(gl, get_uniform_location(A<const program_t &>(), StrEq("lights[2]")))
+        .Times(Exactly(1))
+        .WillOnce(Return(7));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p(gl);
+    p.link();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([&p] {
+            for (size_t j = 0; j < 100; ++j) {
+                EXPECT_EQ(p.get_uniform_location("lights[2]"), 7);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(ProgramTest, moveKeepsTable) {
+    gl_mock_t gl;
+
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    expect_link(gl, {{"model", 3}});
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(Exactly(1));
+
+    program_t p1(gl);
+    p1.link();
+
+    program_t p2(std::move(p1));
+    EXPECT_FALSE(p1.get_id()); // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(p2.get_uniform_location("model"), 3);
+}
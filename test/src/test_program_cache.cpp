@@ -0,0 +1,127 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/program_cache.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::A;
+using testing::AnyNumber;
+using testing::Exactly;
+using testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+const std::vector<shader_source_t> sources = {{shader_type_t::vertex, "void main() {}"},
+                                              {shader_type_t::fragment, "void main() {}"}};
+
+const program_binary_t binary = {0x1234, {std::byte{1}, std::byte{2}, std::byte{3}}};
+
+class ProgramCacheTest : public testing::Test {
+  protected:
+    std::filesystem::path m_directory;
+
+    void SetUp() override {
+        const std::string name = testing::UnitTest::GetInstance()->current_test_info()->name();
+        m_directory = std::filesystem::temp_directory_path() / ("opengl_cpp_program_cache_" + name);
+        std::filesystem::remove_all(m_directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(m_directory);
+    }
+};
+
+void expect_driver(gl_mock_t &gl, bool extension) {
+    EXPECT_CALL(gl, has_extension(extension_t::get_program_binary)).WillRepeatedly(Return(extension));
+    EXPECT_CALL(gl, get_string(_)).WillRepeatedly(Return("driver"));
+    EXPECT_CALL(gl, new_program()).WillRepeatedly(Return(id_program_t(1)));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::active_uniforms))
+        .WillRepeatedly(Return(0));
+}
+
+void expect_compile(gl_mock_t &gl, size_t times) {
+    EXPECT_CALL(gl, new_shader(_)).Times(Exactly(2 * times)).WillRepeatedly(Return(id_shader_t(2)));
+    EXPECT_CALL(gl, set_sources(_, 1, _, _)).Times(Exactly(2 * times));
+    EXPECT_CALL(gl, compile(A<const shader_t &>()))
+        .Times(Exactly(2 * times))
+        .WillRepeatedly(Return(opengl_cpp::error_t::no_error));
+    EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status))
+        .Times(Exactly(2 * times))
+        .WillRepeatedly(Return(GL_TRUE));
+    EXPECT_CALL(gl, attach_shader(_, _)).Times(Exactly(2 * times));
+    EXPECT_CALL(gl, destroy(A<const id_shader_t &>())).Times(Exactly(2 * times));
+    EXPECT_CALL(gl, link(A<const program_t &>()))
+        .Times(Exactly(times))
+        .WillRepeatedly(Return(opengl_cpp::error_t::no_error));
+}
+
+} // namespace
+
+TEST_F(ProgramCacheTest, storesThenLoads) {
+    gl_mock_t gl;
+    expect_driver(gl, true);
+    expect_compile(gl, 1);
+
+    EXPECT_CALL(gl, set_parameter(A<const program_t &>(), program_parameter_t::binary_retrievable_hint, GL_TRUE))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(2))
+        .WillRepeatedly(Return(GL_TRUE));
+    EXPECT_CALL(gl, get_program_binary(_)).Times(Exactly(1)).WillOnce(Return(binary));
+    EXPECT_CALL(gl, program_binary(_, _))
+        .Times(Exactly(1))
+        .WillOnce([](const program_t &, const program_binary_t &loaded) {
+            EXPECT_EQ(loaded.m_format, binary.m_format);
+            EXPECT_EQ(loaded.m_data, binary.m_data);
+            return opengl_cpp::error_t::no_error;
+        });
+
+    program_cache_t cache(gl, m_directory);
+    cache.build(sources);
+    EXPECT_EQ(cache.get_misses(), 1);
+
+    cache.build(sources);
+    EXPECT_EQ(cache.get_hits(), 1);
+}
+
+TEST_F(ProgramCacheTest, rejectedBinaryFallsBack) {
+    gl_mock_t gl;
+    expect_driver(gl, true);
+    expect_compile(gl, 2);
+
+    EXPECT_CALL(gl, set_parameter(A<const program_t &>(), program_parameter_t::binary_retrievable_hint, GL_TRUE))
+        .Times(Exactly(2));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(3))
+        .WillOnce(Return(GL_TRUE))
+        .WillOnce(Return(GL_FALSE))
+        .WillOnce(Return(GL_TRUE));
+    EXPECT_CALL(gl, get_program_binary(_)).Times(Exactly(2)).WillRepeatedly(Return(binary));
+    EXPECT_CALL(gl, program_binary(_, _)).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
+
+    program_cache_t cache(gl, m_directory);
+    cache.build(sources);
+    cache.build(sources);
+    EXPECT_EQ(cache.get_hits(), 0);
+    EXPECT_EQ(cache.get_misses(), 2);
+}
+
+TEST_F(ProgramCacheTest, missingExtension) {
+    gl_mock_t gl;
+    expect_driver(gl, false);
+    expect_compile(gl, 1);
+
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_TRUE));
+    EXPECT_CALL(gl, set_parameter(A<const program_t &>(), _, _)).Times(Exactly(0));
+    EXPECT_CALL(gl, get_program_binary(_)).Times(Exactly(0));
+
+    program_cache_t cache(gl, m_directory);
+    cache.build(sources);
+    EXPECT_FALSE(std::filesystem::exists(m_directory));
+}
@@ -0,0 +1,92 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/program_future.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::A;
+using testing::AnyNumber;
+using testing::Exactly;
+using testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+const std::vector<shader_source_t> sources = {{shader_type_t::vertex, "void main() {}"},
+                                              {shader_type_t::fragment, "void main() {}"}};
+
+void expect_submit(gl_mock_t &gl) {
+    EXPECT_CALL(gl, new_program()).Times(Exactly(1)).WillOnce(Return(id_program_t(1)));
+    EXPECT_CALL(gl, new_shader(_)).Times(Exactly(2)).WillRepeatedly(Return(id_shader_t(2)));
+    EXPECT_CALL(gl, set_sources(_, 1, _, _)).Times(Exactly(2));
+    EXPECT_CALL(gl, compile(A<const shader_t &>()))
+        .Times(Exactly(2))
+        .WillRepeatedly(Return(opengl_cpp::error_t::no_error));
+    EXPECT_CALL(gl, attach_shader(_, _)).Times(Exactly(2));
+    EXPECT_CALL(gl, link(A<const program_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
+    EXPECT_CALL(gl, destroy(A<const id_shader_t &>())).Times(Exactly(2));
+    EXPECT_CALL(gl, destroy(A<const id_program_t &>())).Times(AnyNumber());
+}
+
+} // namespace
+
+TEST(ProgramFutureTest, pollsCompletionStatus) {
+    gl_mock_t gl;
+    expect_submit(gl);
+
+    // Nothing may wait for the driver before get().
+    EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status)).Times(Exactly(0));
+    EXPECT_CALL(gl, has_extension(extension_t::parallel_shader_compile)).WillRepeatedly(Return(true));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::completion_status))
+        .Times(Exactly(2))
+        .WillOnce(Return(GL_FALSE))
+        .WillOnce(Return(GL_TRUE));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_TRUE));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::active_uniforms))
+        .Times(Exactly(1))
+        .WillOnce(Return(0));
+
+    program_future_t future(gl, sources);
+    EXPECT_FALSE(future.is_ready());
+    EXPECT_TRUE(future.is_ready());
+
+    const auto program = future.get();
+    EXPECT_EQ(program.get_id(), id_program_t(1));
+    EXPECT_FALSE(future.is_valid());
+}
+
+TEST(ProgramFutureTest, missingExtensionIsAlwaysReady) {
+    gl_mock_t gl;
+    expect_submit(gl);
+
+    EXPECT_CALL(gl, has_extension(extension_t::parallel_shader_compile)).WillRepeatedly(Return(false));
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::completion_status)).Times(Exactly(0));
+
+    program_future_t future(gl, sources);
+    EXPECT_TRUE(future.is_ready());
+}
+
+TEST(ProgramFutureTest, compileErrorReportedOnGet) {
+    gl_mock_t gl;
+    expect_submit(gl);
+
+    EXPECT_CALL(gl, get_parameter(A<const program_t &>(), program_parameter_t::link_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_FALSE));
+    EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_FALSE));
+    EXPECT_CALL(gl, get_info_log(A<const shader_t &>())).Times(Exactly(1)).WillOnce(Return("syntax error"));
+
+    program_future_t future(gl, sources);
+    try {
+        future.get();
+        FAIL() << "get() should have thrown";
+    } catch (const std::runtime_error &e) {
+        EXPECT_STREQ(e.what(), "syntax error");
+    }
+}
@@ -0,0 +1,54 @@
+#include "opengl-cpp/quantized_vertex.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using namespace opengl_cpp; // NOLINT(google-build-using-namespace)
+
+TEST(QuantizedVertexTest, layout) {
+    static_assert(sizeof(quantized_vertex_t) == 16);
+    static_assert(quantized_vertex_layout.m_stride == 16);
+    EXPECT_EQ(quantized_vertex_layout.m_attributes[0].m_type, vertex_attrib_type_t::unsigned_short);
+    EXPECT_EQ(quantized_vertex_layout.m_attributes[1].m_type, vertex_attrib_type_t::half_float);
+    EXPECT_EQ(quantized_vertex_layout.m_attributes[2].m_components, 2);
+    EXPECT_TRUE(quantized_vertex_layout.m_attributes[2].m_normalized);
+}
+
+TEST(QuantizedVertexTest, halfFloat) {
+    EXPECT_EQ(to_half(0.0F).m_bits, 0x0000);
+    EXPECT_EQ(to_half(1.0F).m_bits, 0x3C00);
+    EXPECT_EQ(to_half(-2.0F).m_bits, 0xC000);
+    EXPECT_EQ(to_half(65504.0F).m_bits, 0x7BFF);
+    EXPECT_EQ(to_half(65520.0F).m_bits, 0x7C00);
+    EXPECT_EQ(to_half(std::ldexp(1.0F, -24)).m_bits, 0x0001);
+    EXPECT_EQ(to_half(1.0F + std::ldexp(1.0F, -11)).m_bits, 0x3C00); // Ties round to even.
+
+    for (const auto value : {0.5F, 0.333251953125F, -1024.0F, std::ldexp(3.0F, -20)}) {
+        EXPECT_EQ(to_float(to_half(value)), value);
+    }
+}
+
+TEST(QuantizedVertexTest, roundTrip) {
+    const std::vector<vertex_t> vertices = {
+        {glm::vec3(-1.0F, 2.0F, 5.0F), glm::vec2(0.0F, 1.0F), glm::vec3(0.0F, 0.0F, 1.0F)},
+        {glm::vec3(3.0F, 2.0F, -5.0F), glm::vec2(0.25F, 0.75F), glm::vec3(0.0F, 0.0F, -1.0F)},
+        {glm::vec3(0.5F, 2.0F, 0.0F), glm::vec2(0.5F, 0.125F), glm::vec3(0.48F, -0.6F, -0.64F)},
+    };
+
+    const auto mesh = quantize(vertices);
+    EXPECT_EQ(mesh.m_bounds_min, glm::vec3(-1.0F, 2.0F, -5.0F));
+    EXPECT_EQ(mesh.m_bounds_extent, glm::vec3(4.0F, 0.0F, 10.0F));
+    EXPECT_EQ(mesh.m_vertices[0].m_pos[0], 0);
+    EXPECT_EQ(mesh.m_vertices[1].m_pos[0], 65535);
+
+    const auto decoded = dequantize(mesh);
+    ASSERT_EQ(decoded.size(), vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        for (int c = 0; c < 3; ++c) {
+            EXPECT_NEAR(decoded[i].m_pos[c], vertices[i].m_pos[c], 1e-4F);
+            EXPECT_NEAR(decoded[i].m_nor[c], vertices[i].m_nor[c], 1e-4F);
+        }
+        EXPECT_EQ(decoded[i].m_tex[0], vertices[i].m_tex[0]);
+        EXPECT_EQ(decoded[i].m_tex[1], vertices[i].m_tex[1]);
+    }
+}
@@ -0,0 +1,73 @@
+#include "opengl-cpp/rect_packer.h"
+#include "gtest/gtest.h"
+
+using namespace opengl_cpp; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+bool overlap(const rect_t &a, const rect_t &b) {
+    return a.m_x < b.m_x + b.m_width && b.m_x < a.m_x + a.m_width && a.m_y < b.m_y + b.m_height &&
+           b.m_y < a.m_y + a.m_height;
+}
+
+} // namespace
+
+TEST(RectPackerTest, fillsWholeArea) {
+    rect_packer_t p(64, 64);
+
+    std::vector<rect_t> rects;
+    for (int i = 0; i < 4; ++i) {
+        const auto r = p.insert(32, 32);
+        ASSERT_TRUE(r.has_value());
+        rects.push_back(*r);
+    }
+
+    EXPECT_EQ(p.get_used_area(), 64 * 64);
+    EXPECT_TRUE(p.get_free_rects().empty());
+    EXPECT_FALSE(p.insert(1, 1).has_value());
+
+    for (size_t i = 0; i < rects.size(); ++i) {
+        for (size_t j = i + 1; j < rects.size(); ++j) {
+            EXPECT_FALSE(overlap(rects[i], rects[j])) << rects[i] << " " << rects[j];
+        }
+    }
+}
+
+TEST(RectPackerTest, mixedSizesDoNotOverlap) {
+    rect_packer_t p(128, 128);
+
+    std::vector<rect_t> rects;
+    for (size_t i = 0; i < 64; ++i) {
+        if (const auto r = p.insert(3 + i * 7 % 29, 2 + i * 11 % 23)) {
+            EXPECT_LE(r->m_x + r->m_width, 128);
+            EXPECT_LE(r->m_y + r->m_height, 128);
+            rects.push_back(*r);
+        }
+    }
+
+    EXPECT_GT(rects.size(), 16);
+    for (size_t i = 0; i < rects.size(); ++i) {
+        for (size_t j = i + 1; j < rects.size(); ++j) {
+            EXPECT_FALSE(overlap(rects[i], rects[j])) << rects[i] << " " << rects[j];
+        }
+    }
+}
+
+TEST(RectPackerTest, removeFreesArea) {
+    rect_packer_t p(64, 32);
+
+    const auto left = p.insert(32, 32);
+    const auto right = p.insert(32, 32);
+    ASSERT_TRUE(left.has_value());
+    ASSERT_TRUE(right.has_value());
+    EXPECT_FALSE(p.insert(16, 16).has_value());
+
+    p.remove(*left);
+    EXPECT_EQ(p.get_used_area(), 32 * 32);
+    EXPECT_EQ(p.insert(32, 32), left);
+
+    p.remove(*left);
+    p.remove(*right);
+    EXPECT_EQ(p.get_used_area(), 0);
+    EXPECT_TRUE(p.insert(64, 32).has_value());
+}
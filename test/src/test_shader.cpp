@@ -18,7 +18,7 @@ TEST(ShaderTest, constructCompileSuccessfull) {
     constexpr auto type = shader_type_t::fragment;
 
     EXPECT_CALL(gl, new_shader(type)).Times(Exactly(1)).WillOnce(Return(id));
-    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>())).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>(), nullptr)).Times(Exactly(1));
     EXPECT_CALL(gl, compile(A<const shader_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
     EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status))
         .Times(Exactly(1))
@@ -51,7 +51,7 @@ TEST(ShaderTest, constructCompileFailed) {
     constexpr auto type = shader_type_t::fragment;
 
     EXPECT_CALL(gl, new_shader(type)).Times(Exactly(1)).WillOnce(Return(id));
-    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>())).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>(), nullptr)).Times(Exactly(1));
     EXPECT_CALL(gl, compile(A<const shader_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
     EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status))
         .Times(Exactly(1))
@@ -111,7 +111,7 @@ TEST(ShaderTest, constructFromPathSucceeded) {
     const auto id = id_shader_t(123);
     constexpr auto type = shader_type_t::fragment;
     EXPECT_CALL(gl, new_shader(type)).Times(Exactly(1)).WillOnce(Return(id));
-    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>())).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>(), A<const int *>())).Times(Exactly(1));
     EXPECT_CALL(gl, compile(A<const shader_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
     EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status))
         .Times(Exactly(1))
@@ -130,7 +130,7 @@ TEST(ShaderTest, constructFromPathCompileFail) {
     const auto id = id_shader_t(123);
     constexpr auto type = shader_type_t::fragment;
     EXPECT_CALL(gl, new_shader(type)).Times(Exactly(1)).WillOnce(Return(id));
-    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>())).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), 1, A<const char **>(), A<const int *>())).Times(Exactly(1));
     EXPECT_CALL(gl, compile(A<const shader_t &>()))
         .Times(Exactly(1))
         .WillOnce(Return(opengl_cpp::error_t::invalid_operation));
@@ -0,0 +1,94 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/shader_library.h"
+#include "gtest/gtest.h"
+
+#include <numeric>
+
+using testing::_;
+using testing::A;
+using testing::Exactly;
+using testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+std::string join(const std::vector<std::string_view> &sources) {
+    return std::accumulate(sources.begin(), sources.end(), std::string(),
+                           [](std::string s, std::string_view chunk) { return s.append(chunk); });
+}
+
+} // namespace
+
+TEST(ShaderLibraryTest, resolvesIncludes) {
+    shader_library_t library({"./shaders/include"});
+
+    const auto &sources = library.get_sources("./shaders/library.frag");
+
+    // common.glsl and lighting.glsl include each other, each file is only included once.
+    EXPECT_EQ(join(sources), "#version 330 core\n"
+                             "vec4 shade(vec4 c) {\n"
+                             "    return c;\n"
+                             "}\n"
+                             "out vec4 color;\n"
+                             "\n"
+                             "void main() {\n"
+                             "    color = shade(vec4(1.0));\n"
+                             "}\n");
+    EXPECT_EQ(library.get_file_count(), 3);
+
+    // Resolved sources are cached.
+    EXPECT_EQ(&library.get_sources("shaders/../shaders/library.frag"), &sources);
+}
+
+TEST(ShaderLibraryTest, includeNotFound) {
+    shader_library_t library;
+    EXPECT_THROW(library.get_sources("./shaders/missing.frag"), std::runtime_error);
+    EXPECT_THROW(library.get_sources("./shaders/not_a_file.frag"), std::runtime_error);
+}
+
+TEST(ShaderLibraryTest, skipsCommentedIncludes) {
+    shader_library_t library({"./shaders/include"});
+
+    const auto &sources = library.get_sources("./shaders/commented.frag");
+
+    EXPECT_EQ(join(sources), "#version 330 core\n"
+                             "// #include \"missing.glsl\"\n"
+                             "/* A block comment\n"
+                             "#include \"missing.glsl\"\n"
+                             "*/\n"
+                             "vec4 shade(vec4 c) {\n"
+                             "    return c;\n"
+                             "}\n"
+                             "out vec4 color;\n"
+                             " /*\n"
+                             "#include <missing.glsl> */\n");
+    EXPECT_EQ(library.get_file_count(), 3);
+}
+
+TEST(ShaderLibraryTest, loadPassesChunks) {
+    gl_mock_t gl;
+    shader_library_t library({"./shaders/include"});
+    const auto &sources = library.get_sources("./shaders/library.frag");
+
+    const auto id = id_shader_t(123);
+    EXPECT_CALL(gl, new_shader(shader_type_t::fragment)).Times(Exactly(1)).WillOnce(Return(id));
+    EXPECT_CALL(gl, set_sources(A<const shader_t &>(), sources.size(), A<const char **>(), A<const int *>()))
+        .Times(Exactly(1))
+        .WillOnce([&sources](const shader_t &, size_t n, const char **strings, const int *lengths) {
+            for (size_t i = 0; i < n; ++i) {
+                EXPECT_EQ(strings[i], sources[i].data());
+                EXPECT_EQ(lengths[i], sources[i].size());
+            }
+        });
+    EXPECT_CALL(gl, compile(A<const shader_t &>())).Times(Exactly(1)).WillOnce(Return(opengl_cpp::error_t::no_error));
+    EXPECT_CALL(gl, get_parameter(A<const shader_t &>(), shader_parameter_t::compile_status))
+        .Times(Exactly(1))
+        .WillOnce(Return(GL_TRUE));
+    EXPECT_CALL(gl, destroy(id)).Times(Exactly(1));
+
+    const auto s = library.load(gl, shader_type_t::fragment, "./shaders/library.frag");
+    EXPECT_EQ(s.get_id(), id);
+}
@@ -0,0 +1,78 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/stream_buffer.h"
+#include "gtest/gtest.h"
+
+using ::testing::A;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+constexpr size_t frame_size = 64;
+
+void expect_create(gl_mock_t &gl, std::vector<std::byte> &storage) {
+    storage.resize(frame_size * stream_buffer_t::frame_count);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1}));
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(1));
+    expect_persistent_mapping(gl, storage);
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+}
+
+} // namespace
+
+TEST(StreamBufferTest, allocateWithinFrame) {
+    gl_mock_t gl;
+    std::vector<std::byte> storage;
+    expect_create(gl, storage);
+
+    stream_buffer_t b(gl, buffer_target_t::simple_array, frame_size);
+    EXPECT_EQ(b.get_buffer().get_size(), storage.size());
+
+    const auto a1 = b.allocate(10);
+    EXPECT_EQ(a1.m_offset, 0);
+    EXPECT_EQ(a1.m_data, storage.data());
+
+    const auto a2 = b.allocate(16, 16);
+    EXPECT_EQ(a2.m_offset, 16);
+    EXPECT_EQ(a2.m_data, storage.data() + 16);
+
+    EXPECT_THROW(b.allocate(frame_size), std::length_error);
+}
+
+TEST(StreamBufferTest, ringWaitsForFences) {
+    gl_mock_t gl;
+    std::vector<std::byte> storage;
+    expect_create(gl, storage);
+
+    EXPECT_CALL(gl, fence_sync())
+        .Times(Exactly(4))
+        .WillOnce(Return(make_sync(1)))
+        .WillOnce(Return(make_sync(2)))
+        .WillOnce(Return(make_sync(3)))
+        .WillOnce(Return(make_sync(4)));
+    EXPECT_CALL(gl, client_wait_sync(make_sync(1), A<uint64_t>()))
+        .Times(Exactly(2))
+        .WillOnce(Return(sync_status_t::timeout_expired))
+        .WillOnce(Return(sync_status_t::condition_satisfied));
+    EXPECT_CALL(gl, client_wait_sync(make_sync(2), A<uint64_t>()))
+        .Times(Exactly(1))
+        .WillOnce(Return(sync_status_t::already_signaled));
+    EXPECT_CALL(gl, destroy(A<sync_t>())).Times(Exactly(4));
+
+    stream_buffer_t b(gl, buffer_target_t::simple_array, frame_size);
+
+    b.allocate(8);
+    b.end_frame();
+    EXPECT_EQ(b.allocate(8).m_offset, frame_size);
+    b.end_frame();
+    EXPECT_EQ(b.allocate(8).m_offset, 2 * frame_size);
+    b.end_frame();
+    EXPECT_EQ(b.get_frame(), 0);
+    EXPECT_EQ(b.allocate(8).m_offset, 0);
+    b.end_frame();
+}
@@ -3,6 +3,7 @@
 #include "opengl-cpp/texture.h"
 #include "gtest/gtest.h"
 
+using testing::_;
 using testing::A;
 using testing::Exactly;
 using testing::Return;
@@ -110,7 +111,7 @@ TEST(TextureTest, setParameter) {
     EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(ids));
     EXPECT_CALL(gl, activate(A<const texture_t &>())).Times(Exactly(1));
     EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(1));
-    EXPECT_CALL(gl, set_parameter(parameter_name, parameter_value)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_parameter(_, parameter_name, parameter_value)).Times(Exactly(1));
     EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
 
     texture_t t1(gl, unit, target);
@@ -133,7 +134,7 @@ TEST(TextureTest, setImage) {
     EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(ids));
     EXPECT_CALL(gl, activate(A<const texture_t &>())).Times(Exactly(1));
     EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(1));
-    EXPECT_CALL(gl, set_image(width, height, format, static_cast<const unsigned char *>(data))).Times(Exactly(1));
+    EXPECT_CALL(gl, set_image(_, width, height, format, static_cast<const unsigned char *>(data))).Times(Exactly(1));
     EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
 
     texture_t t1(gl, unit, target);
@@ -142,6 +143,92 @@ TEST(TextureTest, setImage) {
     EXPECT_EQ(t1.get_id(), ids[0]);
 }
 
+TEST(TextureTest, allocateStorage) {
+    gl_mock_t gl;
+
+    constexpr int unit = 1;
+    constexpr auto target = texture_target_t::tex_2d;
+    const std::vector<id_texture_t> ids = {3};
+    constexpr size_t width = 256;
+    constexpr size_t height = 64;
+    constexpr auto format = texture_internal_format_t::srgb8_alpha8;
+    const size_t levels = texture_t::get_full_levels(width, height);
+    const unsigned char data[] = {0x00, 0x01, 0x02, 0x03}; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+    EXPECT_EQ(levels, 9);
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(ids));
+    EXPECT_CALL(gl, texture_storage(A<const texture_t &>(), levels, format, width, height)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 8, 0, 0, 1, 1, texture_format_t::rgba, pixel_type_t::unsigned_byte,
+                                  static_cast<const void *>(data)))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    texture_t t1(gl, unit, target);
+    t1.allocate(width, height, format, levels);
+    EXPECT_EQ(t1.get_width(), width);
+    EXPECT_EQ(t1.get_height(), height);
+    EXPECT_EQ(t1.get_levels(), levels);
+    EXPECT_EQ(t1.get_internal_format(), format);
+    EXPECT_THROW(t1.allocate(width, height, format), std::logic_error);
+
+    t1.set_sub_image(8, 0, 0, 1, 1, texture_format_t::rgba, static_cast<const void *>(data));
+}
+
+TEST(TextureTest, compressedImage) {
+    gl_mock_t gl;
+
+    constexpr int unit = 0;
+    const std::vector<id_texture_t> ids = {3};
+    constexpr auto format = texture_internal_format_t::bc3_rgba;
+    const std::vector<unsigned char> data(32);
+
+    EXPECT_TRUE(texture_t::is_compressed(format));
+    EXPECT_FALSE(texture_t::is_compressed(texture_internal_format_t::rgba8));
+    EXPECT_EQ(texture_t::get_compressed_size(texture_internal_format_t::bc1_rgb, 5, 3), 16);
+    EXPECT_EQ(texture_t::get_compressed_size(format, 8, 4), 32);
+    EXPECT_EQ(texture_t::get_compressed_size(format, 1, 1), 16);
+
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(2)).WillRepeatedly(Return(ids));
+    EXPECT_CALL(gl, compressed_image(_, 0, format, 8, 4, data.size(), data.data())).Times(Exactly(1));
+    EXPECT_CALL(gl, texture_storage(_, 2, format, 8, 4)).Times(Exactly(1));
+    EXPECT_CALL(gl, compressed_sub_image(_, 1, 0, 0, 4, 2, format, 16, data.data())).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(2));
+
+    texture_t t1(gl, unit, texture_target_t::tex_2d);
+    t1.set_compressed_image(0, 8, 4, format, data.size(), data.data());
+
+    texture_t t2(gl, unit, texture_target_t::tex_2d);
+    t2.allocate(8, 4, format, 2);
+    t2.set_compressed_sub_image(1, 0, 0, 4, 2, 16, data.data());
+}
+
+TEST(TextureTest, allocateArray) {
+    gl_mock_t gl;
+
+    constexpr int unit = 1;
+    constexpr auto target = texture_target_t::tex_2d_array;
+    const std::vector<id_texture_t> ids = {3};
+    constexpr size_t width = 32;
+    constexpr size_t height = 32;
+    constexpr size_t layers = 8;
+    constexpr auto format = texture_internal_format_t::rgba8;
+    const unsigned char data[] = {0x00, 0x01, 0x02, 0x03}; // NOLINT(cppcoreguidelines-avoid-c-arrays)
+
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(ids));
+    EXPECT_CALL(gl, texture_storage_3d(A<const texture_t &>(), 2, format, width, height, layers)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image_3d(A<const texture_t &>(), 1, 0, 0, 5, 16, 16, 1, texture_format_t::rgba,
+                                     pixel_type_t::unsigned_byte, static_cast<const void *>(data)))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    texture_t t1(gl, unit, target);
+    t1.allocate_array(width, height, layers, format, 2);
+    EXPECT_EQ(t1.get_layers(), layers);
+    EXPECT_EQ(t1.get_levels(), 2);
+
+    t1.set_layer_image(5, 1, 0, 0, 16, 16, texture_format_t::rgba, static_cast<const void *>(data));
+}
+
 TEST(TextureTest, generateMipmap) {
     gl_mock_t gl;
 
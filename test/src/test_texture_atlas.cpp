@@ -0,0 +1,102 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/texture_atlas.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+constexpr int unit = 0;
+constexpr size_t page_size = 64;
+constexpr size_t padding = 1;
+
+} // namespace
+
+TEST(TextureAtlasTest, insertUploadsPadded) {
+    gl_mock_t gl;
+    const std::vector<unsigned char> pixels(8 * 8 * 4);
+
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_texture_t>{2}));
+    EXPECT_CALL(gl, activate(_)).Times(Exactly(3));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(3));
+    EXPECT_CALL(gl, texture_storage(_, 1, texture_internal_format_t::rgba8, page_size, page_size)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 0, 0, 10, 10, texture_format_t::rgba, _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 10, 0, 10, 10, texture_format_t::rgba, _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    texture_atlas_t atlas(gl, unit, page_size, texture_internal_format_t::rgba8, padding);
+    const auto a = atlas.insert(8, 8, texture_format_t::rgba, pixels.data());
+    const auto b = atlas.insert(8, 8, texture_format_t::rgba, pixels.data());
+
+    EXPECT_EQ(atlas.get_page_count(), 1);
+    EXPECT_EQ(atlas.get_entry_count(), 2);
+    EXPECT_EQ(atlas.get_entry(a).m_rect, (rect_t{1, 1, 8, 8}));
+    EXPECT_FLOAT_EQ(atlas.get_entry(a).m_uv[0], 1.0F / page_size);
+    EXPECT_FLOAT_EQ(atlas.get_entry(a).m_uv[3], 9.0F / page_size);
+    EXPECT_EQ(atlas.get_entry(b).m_page, 0);
+    EXPECT_EQ(atlas.get_page(0).get_id().get_id(), 2);
+
+    EXPECT_THROW(atlas.insert(page_size - 1, 1, texture_format_t::rgba, pixels.data()), std::length_error);
+}
+
+TEST(TextureAtlasTest, fullPageAddsPage) {
+    gl_mock_t gl;
+    const std::vector<unsigned char> pixels(62 * 62 * 4);
+
+    EXPECT_CALL(gl, new_textures(1))
+        .Times(Exactly(2))
+        .WillOnce(Return(std::vector<id_texture_t>{2}))
+        .WillOnce(Return(std::vector<id_texture_t>{3}));
+    EXPECT_CALL(gl, activate(_)).Times(Exactly(5));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(5));
+    EXPECT_CALL(gl, texture_storage(_, 1, _, page_size, page_size)).Times(Exactly(2));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 0, 0, 64, 64, _, _, _)).Times(Exactly(3));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(2));
+
+    texture_atlas_t atlas(gl, unit, page_size);
+    const auto a = atlas.insert(62, 62, texture_format_t::rgba, pixels.data());
+    const auto *first_page = &atlas.get_page(0);
+    const auto b = atlas.insert(62, 62, texture_format_t::rgba, pixels.data());
+    EXPECT_EQ(&atlas.get_page(0), first_page);
+    EXPECT_EQ(atlas.get_entry(a).m_page, 0);
+    EXPECT_EQ(atlas.get_entry(b).m_page, 1);
+
+    atlas.remove(a);
+    EXPECT_THROW(static_cast<void>(atlas.get_entry(a)), std::out_of_range);
+    const auto c = atlas.insert(62, 62, texture_format_t::rgba, pixels.data());
+    EXPECT_EQ(atlas.get_entry(c).m_page, 0);
+    EXPECT_EQ(atlas.get_page_count(), 2);
+}
+
+TEST(TextureAtlasTest, insertExtrudesEdges) {
+    gl_mock_t gl;
+
+    // 2x2 single channel image, its rows padded to 4 bytes.
+    const std::vector<unsigned char> pixels = {1, 2, 0, 0, 3, 4, 0, 0};
+    std::vector<unsigned char> uploaded;
+
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_texture_t>{2}));
+    EXPECT_CALL(gl, activate(_)).Times(Exactly(2));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(2));
+    EXPECT_CALL(gl, texture_storage(_, 1, texture_internal_format_t::r8, page_size, page_size)).Times(Exactly(1));
+    EXPECT_CALL(gl, set_sub_image(_, 0, 0, 0, 4, 4, texture_format_t::red, pixel_type_t::unsigned_byte, _))
+        .Times(Exactly(1))
+        .WillOnce([&uploaded](const texture_t &, int, size_t, size_t, size_t, size_t, texture_format_t, pixel_type_t,
+                              const void *data) {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            uploaded.assign(bytes, bytes + 16);
+        });
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+
+    texture_atlas_t atlas(gl, unit, page_size, texture_internal_format_t::r8, padding);
+    const auto a = atlas.insert(2, 2, texture_format_t::red, pixels.data());
+    EXPECT_EQ(atlas.get_entry(a).m_rect, (rect_t{1, 1, 2, 2}));
+    EXPECT_EQ(uploaded, (std::vector<unsigned char>{1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4}));
+}
@@ -0,0 +1,96 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/texture_uploader.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+constexpr size_t slot_size = 64;
+constexpr size_t slot_count = 2;
+
+void expect_create(gl_mock_t &gl, std::vector<std::byte> &storage) {
+    storage.resize(slot_size * slot_count);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1}));
+    expect_persistent_mapping(gl, storage);
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(1));
+}
+
+} // namespace
+
+TEST(TextureUploaderTest, acquireUntilExhausted) {
+    gl_mock_t gl;
+    std::vector<std::byte> storage;
+    expect_create(gl, storage);
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, unbind(buffer_target_t::pixel_unpack)).Times(Exactly(1));
+
+    texture_uploader_t u(gl, slot_size, slot_count);
+    EXPECT_THROW(u.acquire(slot_size + 1), std::length_error);
+
+    const auto r1 = u.acquire(16);
+    ASSERT_TRUE(r1.has_value());
+    EXPECT_EQ(r1->m_data, storage.data());
+
+    const auto r2 = u.acquire(slot_size);
+    ASSERT_TRUE(r2.has_value());
+    EXPECT_EQ(r2->m_data, storage.data() + slot_size);
+
+    EXPECT_FALSE(u.acquire(1).has_value());
+    EXPECT_EQ(u.get_free_count(), 0);
+
+    u.discard(*r1);
+    const auto r3 = u.acquire(8);
+    ASSERT_TRUE(r3.has_value());
+    EXPECT_EQ(r3->m_slot, r1->m_slot);
+}
+
+TEST(TextureUploaderTest, uploadFencesSlot) {
+    gl_mock_t gl;
+    std::vector<std::byte> storage;
+    expect_create(gl, storage);
+
+    constexpr int unit = 0;
+    EXPECT_CALL(gl, new_textures(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_texture_t>{2}));
+    EXPECT_CALL(gl, destroy(1, A<const id_texture_t *>())).Times(Exactly(1));
+    EXPECT_CALL(gl, activate(_)).Times(Exactly(1));
+    EXPECT_CALL(gl, bind(A<const texture_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(Exactly(2));
+    EXPECT_CALL(gl, unbind(buffer_target_t::pixel_unpack)).Times(Exactly(2));
+
+    // The second slot starts right after the first one, the pixels are read from that offset.
+    const auto *offset = reinterpret_cast<const void *>(slot_size); // NOLINT(*-reinterpret-cast, *-no-int-to-ptr)
+    EXPECT_CALL(gl, set_sub_image(_, 1, 2, 3, 4, 4, texture_format_t::rgba, pixel_type_t::unsigned_byte, offset))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, fence_sync()).Times(Exactly(1)).WillOnce(Return(make_sync(1)));
+    EXPECT_CALL(gl, client_wait_sync(make_sync(1), 0))
+        .Times(Exactly(2))
+        .WillOnce(Return(sync_status_t::timeout_expired))
+        .WillOnce(Return(sync_status_t::already_signaled));
+    EXPECT_CALL(gl, destroy(make_sync(1))).Times(Exactly(1));
+
+    texture_t t(gl, unit, texture_target_t::tex_2d);
+    texture_uploader_t u(gl, slot_size, slot_count);
+
+    const auto r1 = u.acquire(slot_size);
+    const auto r2 = u.acquire(4 * 4 * 4);
+    ASSERT_TRUE(r2.has_value());
+    u.discard(*r1);
+
+    u.upload(t, *r2, 1, 2, 3, 4, 4, texture_format_t::rgba);
+    EXPECT_EQ(u.get_free_count(), 1);
+
+    u.retire();
+    EXPECT_EQ(u.get_free_count(), 1);
+
+    u.retire();
+    EXPECT_EQ(u.get_free_count(), 2);
+}
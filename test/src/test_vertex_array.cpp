@@ -0,0 +1,199 @@
+#include "gl_mock.h"
+
+#include "opengl-cpp/vertex_array.h"
+#include "gtest/gtest.h"
+
+using ::testing::_;
+using ::testing::A;
+using ::testing::AnyNumber;
+using ::testing::Exactly;
+using ::testing::Return;
+
+using namespace opengl_cpp;       // NOLINT(google-build-using-namespace)
+using namespace opengl_cpp::test; // NOLINT(google-build-using-namespace)
+
+namespace {
+
+void expect_create(gl_mock_t &gl, size_t buffers = 2) {
+    EXPECT_CALL(gl, new_buffers(2)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{1, 2}));
+    EXPECT_CALL(gl, destroy(1, A<const id_buffer_t *>())).Times(Exactly(buffers));
+    EXPECT_CALL(gl, destroy(1, A<const id_vertex_array_t *>())).Times(Exactly(1));
+    EXPECT_CALL(gl, bind(A<const vertex_array_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, bind(A<const buffer_t &>())).Times(AnyNumber());
+    EXPECT_CALL(gl, vertex_attrib_pointer(_, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(gl, vertex_attrib_pointer(_, _, _, _, _, _)).Times(AnyNumber());
+    EXPECT_CALL(gl, enable_vertex_attrib_array(_)).Times(AnyNumber());
+}
+
+} // namespace
+
+TEST(VertexArrayTest, drawWithoutIndices) {
+    gl_mock_t gl;
+    expect_create(gl);
+
+    const std::vector<vertex_t> vertices(3);
+    EXPECT_CALL(gl, buffer_data(_, vertices.size() * sizeof(vertex_t), _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, draw_arrays(0, vertices.size())).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices);
+    EXPECT_EQ(va.get_index_type(), index_type_t::undefined);
+    va.draw();
+}
+
+TEST(VertexArrayTest, customLayout) {
+    gl_mock_t gl;
+
+    struct packed_vertex_t {
+        std::array<half_t, 4> m_pos;
+        packed_2_10_10_10_t m_nor;
+        std::array<uint16_t, 2> m_tex;
+    };
+    constexpr auto layout =
+        make_vertex_layout<packed_vertex_t>(make_vertex_attribute<decltype(packed_vertex_t::m_pos)>(0, 0),
+                                            make_vertex_attribute<packed_2_10_10_10_t>(2, 8, true),
+                                            make_vertex_attribute<std::array<uint16_t, 2>>(1, 12, true));
+    static_assert(layout.m_stride == 16);
+    static_assert(layout.m_attributes[0].m_components == 4);
+    static_assert(layout.m_attributes[0].m_type == vertex_attrib_type_t::half_float);
+
+    expect_create(gl);
+    const std::vector<packed_vertex_t> vertices(3);
+    EXPECT_CALL(gl, buffer_data(_, vertices.size() * 16, _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(0, 4, vertex_attrib_type_t::half_float, false, 16, 0)).Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(2, 4, vertex_attrib_type_t::int_2_10_10_10_rev, true, 16, 8))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(1, 2, vertex_attrib_type_t::unsigned_short, true, 16, 12)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices, layout);
+    EXPECT_EQ(va.get_vertex_count(), vertices.size());
+}
+
+TEST(VertexArrayTest, shortIndices) {
+    gl_mock_t gl;
+    expect_create(gl);
+
+    const std::vector<vertex_t> vertices(4);
+    const std::vector<unsigned> indices = {0, 1, 2, 2, 3, 0};
+    EXPECT_CALL(gl, buffer_data(_, vertices.size() * sizeof(vertex_t), _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, indices.size() * sizeof(uint16_t), _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, draw_elements(indices.size(), index_type_t::unsigned_short, 0)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices, indices);
+    EXPECT_EQ(va.get_index_count(), indices.size());
+    va.draw();
+}
+
+TEST(VertexArrayTest, intIndices) {
+    gl_mock_t gl;
+    expect_create(gl);
+
+    const std::vector<vertex_t> vertices(70000);
+    const std::vector<unsigned> indices = {0, 65536, 69999};
+    EXPECT_CALL(gl, buffer_data(_, vertices.size() * sizeof(vertex_t), _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, indices.size() * sizeof(unsigned), _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, draw_elements(indices.size(), index_type_t::unsigned_int, 0)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices, indices);
+    va.draw();
+}
+
+TEST(VertexArrayTest, loadIndicesBindsVertexArray) {
+    gl_mock_t gl;
+    expect_create(gl);
+
+    const std::vector<uint16_t> indices = {0, 1, 2};
+    EXPECT_CALL(gl, bind(A<const vertex_array_t &>())).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, indices.size() * sizeof(uint16_t), indices.data(), _)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load_indices(indices.data(), indices.size(), index_type_t::unsigned_short);
+    EXPECT_EQ(va.get_index_count(), indices.size());
+}
+
+TEST(VertexArrayTest, instances) {
+    struct instance_t {
+        glm::mat4 m_model;
+        glm::vec4 m_color;
+    };
+
+    gl_mock_t gl;
+    expect_create(gl, 3);
+
+    const std::vector<vertex_t> vertices(4);
+    const std::vector<unsigned> indices = {0, 1, 2, 2, 3, 0};
+    const std::vector<instance_t> instances(100);
+    constexpr unsigned first_location = 3;
+    constexpr size_t attributes = 5;
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, buffer_data(_, _, _, buffer_usage_t::static_draw)).Times(Exactly(2));
+    EXPECT_CALL(gl, buffer_data(_, instances.size() * sizeof(instance_t), instances.data(),
+                                buffer_usage_t::dynamic_draw))
+        .Times(Exactly(2));
+    EXPECT_CALL(gl, buffer_sub_data(_, _, _, _)).Times(Exactly(0));
+    for (unsigned i = 0; i < attributes; ++i) {
+        EXPECT_CALL(gl, vertex_attrib_pointer(first_location + i, 4, sizeof(instance_t), i * 4 * sizeof(float)))
+            .Times(Exactly(2));
+        EXPECT_CALL(gl, vertex_attrib_divisor(first_location + i, 1)).Times(Exactly(2));
+    }
+    EXPECT_CALL(gl, draw_elements_instanced(indices.size(), index_type_t::unsigned_short, 0, instances.size()))
+        .Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices, indices);
+    va.load_instances(first_location, instances, {4, 4, 4, 4, 4});
+    va.load_instances(first_location, instances, {4, 4, 4, 4, 4});
+    EXPECT_EQ(va.get_instance_count(), instances.size());
+    va.draw();
+}
+
+TEST(VertexArrayTest, instancesDivisor) {
+    gl_mock_t gl;
+    expect_create(gl, 3);
+
+    const std::vector<vertex_t> vertices(3);
+    const std::vector<glm::vec4> colors(5);
+    constexpr unsigned divisor = 3;
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, buffer_data(_, _, _, _)).Times(Exactly(2));
+    EXPECT_CALL(gl, vertex_attrib_divisor(0, divisor)).Times(Exactly(1));
+    EXPECT_CALL(gl, draw_arrays_instanced(0, vertices.size(), colors.size() * divisor)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices);
+    va.load_instances(0, colors, {4}, divisor);
+    EXPECT_EQ(va.get_instance_count(), colors.size() * divisor);
+    va.draw();
+}
+
+TEST(VertexArrayTest, instancesChangeLayout) {
+    gl_mock_t gl;
+    expect_create(gl, 3);
+
+    const std::vector<vertex_t> vertices(3);
+    const std::vector<glm::vec4> colors(4);
+    const std::vector<glm::vec2> offsets(8);
+
+    EXPECT_CALL(gl, new_buffers(1)).Times(Exactly(1)).WillOnce(Return(std::vector<id_buffer_t>{3}));
+    EXPECT_CALL(gl, buffer_data(_, vertices.size() * sizeof(vertex_t), _, _)).Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, colors.size() * sizeof(glm::vec4), colors.data(), buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, buffer_data(_, offsets.size() * sizeof(glm::vec2), offsets.data(), buffer_usage_t::dynamic_draw))
+        .Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(4, 4, sizeof(glm::vec4), 0)).Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_pointer(4, 2, sizeof(glm::vec2), 0)).Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_divisor(4, 2)).Times(Exactly(1));
+    EXPECT_CALL(gl, vertex_attrib_divisor(4, 1)).Times(Exactly(1));
+
+    vertex_array_t va(gl, 1);
+    va.load(vertices);
+    va.load_instances(4, colors, {4}, 2);
+    EXPECT_EQ(va.get_instance_count(), colors.size() * 2);
+    va.load_instances(4, offsets, {2});
+    EXPECT_EQ(va.get_instance_count(), offsets.size());
+}
@@ -0,0 +1,25 @@
+#include "opengl-cpp/mesh_file.h"
+#include "opengl-cpp/mesh_importer.h"
+
+#include <exception>
+#include <iostream>
+
+// Converts OBJ and glTF binary meshes into mesh files, to be loaded later without any parsing.
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <input.obj|input.glb> <output.mesh>" << std::endl;
+        return 1;
+    }
+
+    try {
+        const opengl_cpp::mesh_importer_t importer;
+        const auto mesh = importer.import(argv[1]);
+        opengl_cpp::mesh_file_t::write(argv[2], mesh.m_vertices, mesh.m_indices);
+        std::cout << argv[2] << ": " << mesh.m_vertices.size() << " vertices, " << mesh.m_indices.size() << " indices"
+                  << std::endl;
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}